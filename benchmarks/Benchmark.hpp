@@ -0,0 +1,147 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace IDragnev::Benchmark
+{
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    //returns the average time of a single call of f in nanoseconds
+    template <typename Callable>
+    double measure(Callable f, std::size_t iterations)
+    {
+        using Clock = std::chrono::steady_clock;
+        using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+        for (auto i = std::size_t{ 0 }; i < iterations / 10; ++i)
+        {
+            f();
+        }
+
+        const auto start = Clock::now();
+        for (auto i = std::size_t{ 0 }; i < iterations; ++i)
+        {
+            f();
+        }
+        const auto elapsed = Nanoseconds(Clock::now() - start);
+
+        return elapsed.count() / iterations;
+    }
+
+    //the fixture of the benchmarks which copy tuples of strings
+    namespace StringTuples
+    {
+        inline constexpr auto iterations = std::size_t{ 1'000'000 };
+
+        //too long for the small string optimization, so that every copy allocates
+        inline const auto text = std::string(64, 'x');
+    }
+
+    //a named number measured by a benchmark, such as its time per operation or a size in bytes
+    struct Metric
+    {
+        template <typename T,
+                  typename = std::enable_if_t<std::is_arithmetic_v<T>>
+        > Metric(std::string name, T value) :
+            name(std::move(name)),
+            value(static_cast<double>(value))
+        {
+        }
+
+        std::string name;
+        double value;
+    };
+
+    //collects the results of a run and writes them as JSON:
+    //[{"case": ..., "implementation": ..., "ns_per_op": ...}, ...]
+    //a result may carry other metrics instead of or besides ns_per_op, each written as a field of its own
+    class JsonReport
+    {
+    public:
+        void add(const std::string& benchmarkCase, const std::string& implementation, double nsPerOp)
+        {
+            add(benchmarkCase, implementation, { { "ns_per_op", nsPerOp } });
+        }
+
+        void add(const std::string& benchmarkCase, const std::string& implementation, std::vector<Metric> metrics)
+        {
+            results.push_back({ benchmarkCase, implementation, std::move(metrics) });
+        }
+
+        void write(std::ostream& out) const
+        {
+            out << "[\n";
+            for (auto i = std::size_t{ 0 }; i < results.size(); ++i)
+            {
+                const auto& r = results[i];
+                out << "  {\"case\": \"" << escaped(r.benchmarkCase)
+                    << "\", \"implementation\": \"" << escaped(r.implementation) << "\"";
+                for (const auto& m : r.metrics)
+                {
+                    out << ", \"" << escaped(m.name) << "\": " << m.value;
+                }
+                out << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+            }
+            out << "]\n";
+        }
+
+    private:
+        struct Result
+        {
+            std::string benchmarkCase;
+            std::string implementation;
+            std::vector<Metric> metrics;
+        };
+
+        //the contents of a JSON string holding s
+        static std::string escaped(const std::string& s)
+        {
+            auto result = std::string{};
+            result.reserve(s.size());
+
+            for (const auto c : s)
+            {
+                switch (c)
+                {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\t': result += "\\t"; break;
+                case '\r': result += "\\r"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char code[7];
+                        std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                        result += code;
+                    }
+                    else
+                    {
+                        result += c;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        std::vector<Result> results;
+    };
+}
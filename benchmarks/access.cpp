@@ -0,0 +1,58 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using IDragnev::Variant;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    using V = Variant<int, float>;
+
+    constexpr auto size = std::size_t{ 1'000'000 };
+
+    template <typename Access>
+    void sumInts(JsonReport& json, const std::string& name, const std::vector<V>& values, Access access)
+    {
+        json.add("sum of the ints in a vector of Variant<int, float>", name, measure([&]
+        {
+            auto sum = 0ll;
+            for (const auto& v : values)
+            {
+                if (v.index() == V::indexOf<int>)
+                {
+                    sum += access(v);
+                }
+            }
+            doNotOptimize(sum);
+        }, 50) / size);
+    }
+}
+
+int main()
+{
+    auto values = std::vector<V>{};
+    values.reserve(size);
+
+    for (auto i = std::size_t{ 0 }; i < size; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            values.push_back(int(i));
+        }
+        else
+        {
+            values.push_back(float(i));
+        }
+    }
+
+    auto json = JsonReport{};
+
+    sumInts(json, "get<T>", values, [](const V& v) { return v.get<int>(); });
+    sumInts(json, "getIf<T>", values, [](const V& v) { return *v.getIf<int>(); });
+    sumInts(json, "getUnchecked<T>", values, [](const V& v) { return v.getUnchecked<int>(); });
+
+    json.write(std::cout);
+}
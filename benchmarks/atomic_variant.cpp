@@ -0,0 +1,151 @@
+#include "Benchmark.hpp"
+#include "AtomicVariant.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using IDragnev::AtomicVariant;
+using IDragnev::Variant;
+using IDragnev::visit;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Quote
+    {
+        std::int16_t bid;
+        std::int16_t ask;
+    };
+
+    struct Trade
+    {
+        std::int32_t price;
+    };
+
+    struct Book
+    {
+        std::int64_t levels[8];
+    };
+
+    template <typename V>
+    class Locked
+    {
+    public:
+        V load() const
+        {
+            auto lock = std::lock_guard<std::mutex>{ mutex };
+            return value;
+        }
+
+        void store(const V& v)
+        {
+            auto lock = std::lock_guard<std::mutex>{ mutex };
+            value = v;
+        }
+
+    private:
+        mutable std::mutex mutex;
+        V value;
+    };
+
+    struct Sum
+    {
+        std::int64_t operator()(const Quote& q) const { return q.bid; }
+        std::int64_t operator()(const Trade& t) const { return t.price; }
+        std::int64_t operator()(const Book& b) const { return b.levels[0]; }
+    };
+
+    //one writer stores continuously while the readers load for a fixed time
+    template <typename Cell, typename First, typename Second>
+    void readThroughput(JsonReport& json, const std::string& name, std::size_t readersCount, First first, Second second)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        auto cell = Cell{};
+        auto stop = std::atomic<bool>{ false };
+        auto reads = std::atomic<std::uint64_t>{ 0 };
+        auto readers = std::vector<std::thread>{};
+
+        auto writer = std::thread([&]
+        {
+            for (auto i = std::uint64_t{ 0 }; !stop.load(std::memory_order_relaxed); ++i)
+            {
+                if (i % 2 == 0)
+                {
+                    cell.store(first);
+                }
+                else
+                {
+                    cell.store(second);
+                }
+            }
+        });
+
+        const auto start = Clock::now();
+
+        for (auto r = std::size_t{ 0 }; r < readersCount; ++r)
+        {
+            readers.emplace_back([&]
+            {
+                auto count = std::uint64_t{ 0 };
+                auto sum = std::int64_t{ 0 };
+
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    sum += visit(cell.load(), Sum{});
+                    ++count;
+                }
+
+                doNotOptimize(sum);
+                reads += count;
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        stop = true;
+
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+        writer.join();
+
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const auto readsCount = static_cast<double>(reads.load());
+        json.add("load while one thread stores, " + std::to_string(readersCount) + " readers", name,
+                 { { "ns_per_op", seconds * 1e9 / readsCount }, { "mreads_per_s", readsCount / seconds / 1e6 } });
+    }
+
+    template <typename Cell, typename First, typename Second>
+    void scaleReaders(JsonReport& json, const std::string& name, First first, Second second)
+    {
+        for (const auto readers : { 1u, 2u, 4u, 8u })
+        {
+            readThroughput<Cell>(json, name, readers, first, second);
+        }
+    }
+}
+
+int main()
+{
+    using Small = Variant<Quote, Trade>;
+    using Large = Variant<Book, Trade>;
+
+    auto json = JsonReport{};
+
+    json.add("machine", "", { { "hardware_threads", std::thread::hardware_concurrency() } });
+    json.add("small variant", "AtomicVariant<Quote, Trade>", { { "bytes", sizeof(Small) },
+                                                               { "lock_free", AtomicVariant<Quote, Trade>::isLockFree } });
+
+    scaleReaders<AtomicVariant<Quote, Trade>>(json, "atomic, small", Quote{ 1, 2 }, Trade{ 3 });
+    scaleReaders<Locked<Small>>(json, "mutex, small", Small(Quote{ 1, 2 }), Small(Trade{ 3 }));
+    scaleReaders<AtomicVariant<Book, Trade>>(json, "seqlock, large", Book{}, Trade{ 3 });
+    scaleReaders<Locked<Large>>(json, "mutex, large", Large(Book{}), Large(Trade{ 3 }));
+
+    json.write(std::cout);
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Compares the object code of tuple pipelines applied one stage at a time, composed and on a view of the tuple.
+
+For each pipeline a translation unit with a single function which applies it to a tuple of
+strings is compiled with -O2 -c in each form. Composed stages are applied as a single select
+and on a view the stages only compose indices, so in both forms the chosen components are
+copied once. The size of the code (the sum of the .text sections) is reported as JSON,
+one record per compiler and pipeline:
+  python3 benchmarks/code_size.py --compilers g++ clang++ > code_size.json
+Compilers which are not installed are skipped.
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE = os.path.join(ROOT, "include")
+
+PRELUDE = """#include "tuple/Tuple.hpp"
+#include "tuple/TupleAlgorithms.hpp"
+#include <string>
+
+using namespace IDragnev;
+using namespace IDragnev::TupleAlgorithms;
+using S = std::string;
+
+std::size_t totalSize(const Tuple<S, S, S, S, S, S, S, S>& t)
+{
+    const auto sum = [](const auto& result) { return foldl(result, std::size_t{ 0 }, [](auto acc, const auto& s) { return acc + s.size(); }); };
+    return %s;
+}
+"""
+
+#each pipeline as stages applied to t one at a time, composed before they are applied to t and applied to a view of t
+PIPELINES = {
+    "drop, take, reverse": ("t | drop<2> | take<5> | reverse | sum",
+                            "t | (drop<2> | take<5> | reverse) | sum",
+                            "asView(t) | drop<2> | take<5> | reverse | materialize | sum"),
+    "reverse, drop, drop, take": ("t | reverse | drop<1> | drop<1> | take<3> | sum",
+                                  "t | (reverse | drop<1> | drop<1> | take<3>) | sum",
+                                  "asView(t) | reverse | drop<1> | drop<1> | take<3> | materialize | sum"),
+    "select, replicate": ("t | TupleAlgorithms::select<0, 7> | replicate<1, 4> | sum",
+                          "t | (TupleAlgorithms::select<0, 7> | replicate<1, 4>) | sum",
+                          "asView(t) | TupleAlgorithms::select<0, 7> | replicate<1, 4> | materialize | sum"),
+}
+
+
+def text_size(compiler, source, directory):
+    path = os.path.join(directory, "unit.cpp")
+    with open(path, "w") as f:
+        f.write(source)
+
+    obj = os.path.join(directory, "unit.o")
+    subprocess.run([compiler, "-std=c++17", "-O2", "-c", "-I", INCLUDE, path, "-o", obj], check=True)
+
+    sections = subprocess.run(["size", "-A", obj], check=True, capture_output=True, text=True).stdout
+    return sum(int(line.split()[1]) for line in sections.splitlines() if line.startswith(".text"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compilers", nargs="+", default=["g++", "clang++"])
+    arguments = parser.parse_args()
+
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        for compiler in arguments.compilers:
+            if shutil.which(compiler) is None:
+                print("skipping {}: not found".format(compiler), file=sys.stderr)
+                continue
+
+            for name, (stages, composed, view) in PIPELINES.items():
+                record = {
+                    "compiler": compiler,
+                    "pipeline": name,
+                    "stage_by_stage_bytes": text_size(compiler, PRELUDE % stages, directory),
+                    "composed_bytes": text_size(compiler, PRELUDE % composed, directory),
+                    "view_bytes": text_size(compiler, PRELUDE % view, directory),
+                }
+                results.append(record)
+                print(json.dumps(record), file=sys.stderr)
+
+    json.dump(results, sys.stdout, indent=2)
+    print()
+
+
+if __name__ == "__main__":
+    main()
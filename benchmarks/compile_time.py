@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+"""Measures the compile-time cost of the Meta list algorithms.
+
+For each algorithm and list size a translation unit which applies the algorithm
+to a list of distinct types is generated and compiled with -fsyntax-only.
+Programs such as "Variant" and "Tuple" instead use every alternative of a Variant of the list
+or every component of a Tuple of it.
+Each compiler records:
+  seconds - the wall time of the compilation
+  peak_kb - the peak resident memory of the compiler
+  depth   - the smallest -ftemplate-depth which compiles the unit (with --depth)
+
+Results are written as JSON, one record per compiler, algorithm and size:
+  python3 benchmarks/compile_time.py --compilers g++ clang++ --depth > compile_time.json
+Compilers which are not installed are skipped.
+"""
+
+import argparse
+import json
+import os
+import resource
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE = os.path.join(ROOT, "include")
+
+#the depth the timed compilations are allowed, large enough for every size
+MAX_DEPTH = 1 << 16
+
+PRELUDE = """#include "meta/ListAlgorithms.hpp"
+#include "meta/Pair.hpp"
+#include "meta/TypeFunctionsAndPredicates.hpp"
+#include <cstddef>
+#include <type_traits>
+
+using namespace IDragnev::Meta;
+
+//distinct types of varying sizes
+template <std::size_t I>
+struct T
+{
+    char bytes[I % 61 + 1];
+};
+
+"""
+
+#each algorithm is an expression over List, a list of N distinct types in decreasing order
+ALGORITHMS = {
+    "InsertionSort": "InsertionSort<List, IsSmallerT>",
+    "MakeSet": "MakeSet<Concat<Take<N / 2, List>, Take<N / 2, List>>>",
+    "Zip": "Zip<MakePairT, List, Reverse<List>>",
+    "Reverse": "Reverse<List>",
+    "indexOf": "ValueList<std::size_t, indexOf<T<0>, List>>",
+    "ListRef": "ListRef<List, N - 1>",
+    "Concat": "Concat<List, List>",
+    "MakeIndexList": "MakeIndexList<N>",
+    "ReplicateValue": "ReplicateValue<1, N>",
+}
+
+#whole programs over List, for the cost of the library built on the algorithms
+PROGRAMS = {
+    "Variant": """#include "variant/Variant.hpp"
+
+template <typename L>
+struct UseEveryAlternative;
+
+template <typename... Types>
+struct UseEveryAlternative<TypeList<Types...>>
+{
+    using V = IDragnev::Variant<Types...>;
+
+    static std::size_t run(V& v)
+    {
+        auto result = std::size_t{ 0 };
+        ((result += v.template is<Types>() ? sizeof(v.template get<Types>()) : 0), ...);
+        ((v = Types{}), ...);
+        return result + IDragnev::visit(v, [](const auto& x) { return sizeof(x); });
+    }
+};
+
+auto run = &UseEveryAlternative<List>::run;
+""",
+    "Tuple": """#include "tuple/Tuple.hpp"
+#include "tuple/TupleAlgorithms.hpp"
+
+template <typename L>
+struct UseEveryComponent;
+
+template <typename... Types>
+struct UseEveryComponent<TypeList<Types...>>
+{
+    static std::size_t run()
+    {
+        auto tuple = IDragnev::Tuple<Types...>{};
+        auto copy = tuple;
+        auto result = sizeof(IDragnev::get<sizeof...(Types) - 1>(copy));
+        IDragnev::TupleAlgorithms::forEach(tuple, [&result](const auto& x) { result += sizeof(x); });
+        return result;
+    }
+};
+
+auto run = &UseEveryComponent<List>::run;
+""",
+}
+
+#the part of each unit which is not the algorithm itself, subtracted from the results
+BASELINE = "List"
+
+
+def source(algorithm, size):
+    types = ", ".join("T<{}>".format(i) for i in reversed(range(size)))
+    unit = (PRELUDE +
+            "constexpr std::size_t N = {};\n".format(size) +
+            "using List = TypeList<{}>;\n".format(types))
+
+    if algorithm in PROGRAMS:
+        return unit + PROGRAMS[algorithm]
+
+    expression = ALGORITHMS.get(algorithm, BASELINE)
+    return unit + "using Result = {};\nstatic_assert(!std::is_void_v<Result>);\n".format(expression)
+
+
+def compile_unit(compiler, path, depth, arguments):
+    """returns (succeeded, seconds, peak_kb)"""
+    command = [compiler, "-std=c++17", "-fsyntax-only", "-I", INCLUDE,
+               "-ftemplate-depth={}".format(depth), path]
+    limit = arguments.memory_limit_mb * 1024 * 1024
+
+    def limit_memory():
+        resource.setrlimit(resource.RLIMIT_AS, (limit, limit))
+
+    start = time.monotonic()
+    process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, preexec_fn=limit_memory)
+    deadline = start + arguments.timeout
+
+    while True:
+        pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+        if pid != 0:
+            break
+        if time.monotonic() > deadline:
+            process.kill()
+            os.wait4(process.pid, 0)
+            return False, None, None
+        time.sleep(0.005)
+
+    seconds = time.monotonic() - start
+    return os.waitstatus_to_exitcode(status) == 0, seconds, usage.ru_maxrss
+
+
+def least_depth(compiler, path, arguments):
+    """the smallest -ftemplate-depth which compiles the unit, by bisection"""
+    low, high = 1, MAX_DEPTH
+    while low < high:
+        middle = (low + high) // 2
+        succeeded, _, _ = compile_unit(compiler, path, middle, arguments)
+        if succeeded:
+            high = middle
+        else:
+            low = middle + 1
+    return low
+
+
+def measure(compiler, algorithm, size, directory, arguments):
+    path = os.path.join(directory, "unit.cpp")
+    with open(path, "w") as f:
+        f.write(source(algorithm, size))
+
+    runs = [compile_unit(compiler, path, MAX_DEPTH, arguments) for _ in range(arguments.repeat)]
+    if not all(succeeded for succeeded, _, _ in runs):
+        return {"error": "failed, timed out or ran out of memory"}
+
+    result = {
+        "seconds": min(seconds for _, seconds, _ in runs),
+        "peak_kb": max(peak for _, _, peak in runs),
+    }
+    if arguments.depth:
+        result["depth"] = least_depth(compiler, path, arguments)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compilers", nargs="+", default=["g++", "clang++"])
+    parser.add_argument("--algorithms", nargs="+", default=list(ALGORITHMS) + list(PROGRAMS),
+                        choices=list(ALGORITHMS) + list(PROGRAMS))
+    parser.add_argument("--sizes", nargs="+", type=int, default=[16, 32, 64, 128, 256, 512, 1024])
+    parser.add_argument("--repeat", type=int, default=3, help="compilations per measurement, the fastest is kept")
+    parser.add_argument("--timeout", type=float, default=300, help="seconds allowed for one compilation")
+    parser.add_argument("--memory-limit-mb", type=int, default=8192, help="address space allowed for one compilation")
+    parser.add_argument("--depth", action="store_true", help="also find the instantiation depth (slower)")
+    arguments = parser.parse_args()
+
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        for compiler in arguments.compilers:
+            if shutil.which(compiler) is None:
+                print("skipping {}: not found".format(compiler), file=sys.stderr)
+                continue
+
+            for size in arguments.sizes:
+                baseline = measure(compiler, None, size, directory, arguments)
+
+                for algorithm in arguments.algorithms:
+                    result = measure(compiler, algorithm, size, directory, arguments)
+                    if "seconds" in result and "seconds" in baseline:
+                        result["seconds_over_baseline"] = max(result["seconds"] - baseline["seconds"], 0.0)
+
+                    record = {"compiler": compiler, "algorithm": algorithm, "size": size}
+                    record.update(result)
+                    results.append(record)
+                    print(json.dumps(record), file=sys.stderr)
+
+    json.dump(results, sys.stdout, indent=2)
+    print()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+#include "Benchmark.hpp"
+#include "Tuple.hpp"
+#include "TupleAlgorithms.hpp"
+#include <iostream>
+#include <string>
+#include <utility>
+
+using IDragnev::makeTuple;
+using namespace IDragnev::Benchmark;
+using namespace IDragnev::Benchmark::StringTuples;
+
+namespace
+{
+    namespace alg = IDragnev::TupleAlgorithms;
+
+    //concatenation two tuples at a time, through an intermediate tuple at each step
+    template <typename U, typename V>
+    auto pairwise(U&& u, V&& v)
+    {
+        return alg::concatenate(std::forward<U>(u), std::forward<V>(v));
+    }
+
+    template <typename U, typename V, typename W, typename... Rest>
+    auto pairwise(U&& u, V&& v, W&& w, Rest&&... rest)
+    {
+        return pairwise(pairwise(std::forward<U>(u), std::forward<V>(v)),
+                        std::forward<W>(w),
+                        std::forward<Rest>(rest)...);
+    }
+
+    template <typename Concatenate>
+    void copies(JsonReport& json, const std::string& name, Concatenate concatenate)
+    {
+        const auto a = makeTuple(text, text);
+        const auto b = makeTuple(text, text);
+        const auto c = makeTuple(text, text);
+        const auto d = makeTuple(text, text);
+
+        json.add("concatenate 4 tuples of 2 strings, copying", name, measure([&]
+        {
+            doNotOptimize(a);
+            const auto result = concatenate(a, b, c, d);
+            doNotOptimize(result);
+        }, iterations));
+    }
+
+    template <typename Concatenate>
+    void moves(JsonReport& json, const std::string& name, Concatenate concatenate)
+    {
+        json.add("concatenate 4 tuples of 2 strings, moving", name, measure([&]
+        {
+            auto a = makeTuple(text, text);
+            auto b = makeTuple(text, text);
+            auto c = makeTuple(text, text);
+            auto d = makeTuple(text, text);
+            const auto result = concatenate(std::move(a), std::move(b), std::move(c), std::move(d));
+            doNotOptimize(result);
+        }, iterations));
+    }
+}
+
+int main()
+{
+    const auto singlePass = [](auto&&... tuples) { return alg::concatenate(std::forward<decltype(tuples)>(tuples)...); };
+    const auto twoAtATime = [](auto&&... tuples) { return pairwise(std::forward<decltype(tuples)>(tuples)...); };
+
+    auto json = JsonReport{};
+
+    copies(json, "single pass", singlePass);
+    copies(json, "two at a time", twoAtATime);
+    moves(json, "single pass", singlePass);
+    moves(json, "two at a time", twoAtATime);
+
+    json.write(std::cout);
+}
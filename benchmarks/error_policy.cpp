@@ -0,0 +1,77 @@
+//Build once per error policy and compare, for example:
+//  g++ -O2 -DNDEBUG error_policy.cpp
+//  g++ -O2 -DNDEBUG -fno-exceptions error_policy.cpp
+//  g++ -O2 -DNDEBUG -fno-exceptions -DIDRAGNEV_ERROR_POLICY=IDRAGNEV_ERROR_POLICY_UNREACHABLE error_policy.cpp
+//sumByGet and sumByVisit are kept out of line so that their code
+//can be compared with objdump -d as well.
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using IDragnev::Variant;
+using IDragnev::visit;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    using V = Variant<int, float, double>;
+
+    constexpr auto size = std::size_t{ 1'000'000 };
+
+    const char* policyName()
+    {
+#if IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_THROW
+        return "throw";
+#elif IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_ABORT
+        return "abort";
+#else
+        return "unreachable";
+#endif
+    }
+}
+
+[[gnu::noinline]] long long sumByGet(const std::vector<V>& values)
+{
+    auto sum = 0ll;
+    for (const auto& v : values)
+    {
+        sum += v.get<int>();
+    }
+    return sum;
+}
+
+[[gnu::noinline]] double sumByVisit(const std::vector<V>& values)
+{
+    auto sum = 0.0;
+    for (const auto& v : values)
+    {
+        sum += visit(v, [](auto x) { return static_cast<double>(x); });
+    }
+    return sum;
+}
+
+int main()
+{
+    auto ints = std::vector<V>(size, V(1));
+    auto mixed = std::vector<V>{};
+    mixed.reserve(size);
+
+    for (auto i = std::size_t{ 0 }; i < size; ++i)
+    {
+        switch (i % 3)
+        {
+        case 0: mixed.push_back(int(i)); break;
+        case 1: mixed.push_back(float(i)); break;
+        default: mixed.push_back(double(i)); break;
+        }
+    }
+
+    auto json = JsonReport{};
+
+    json.add("get<T>", policyName(), measure([&] { doNotOptimize(sumByGet(ints)); }, 200) / size);
+    json.add("visit", policyName(), measure([&] { doNotOptimize(sumByVisit(mixed)); }, 200) / size);
+
+    json.write(std::cout);
+}
@@ -0,0 +1,64 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+using IDragnev::Variant;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    enum class Kind : std::uint8_t { request, response, error };
+
+    struct Packet
+    {
+        std::uint32_t id;
+        std::uint16_t length;
+        std::uint8_t flags;
+        Kind kind;
+    };
+
+    struct alignas(16) Node
+    {
+        Node* children[2];
+    };
+
+    struct Leaf { };
+    struct Pending { };
+}
+
+namespace IDragnev
+{
+    template <>
+    struct NicheTraits<Packet> : ByteNiche<offsetof(Packet, kind), 3> { };
+
+    template <>
+    struct NicheTraits<Node*> : PointerNiche<Node*, alignof(Node)> { };
+}
+
+namespace
+{
+    template <typename... Types>
+    void reportLayout(JsonReport& json, const std::string& name)
+    {
+        using Tagged = IDragnev::Detail::TaggedLayout<Types...>;
+
+        json.add(name, "IDragnev::Variant", { { "bytes", sizeof(Variant<Types...>) } });
+        json.add(name, "separate discriminator", { { "bytes", sizeof(Tagged) } });
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    reportLayout<double, std::int64_t>(json, "Variant<double, int64_t>");
+    reportLayout<Packet, std::uint32_t, std::uint16_t>(json, "Variant<Packet, uint32_t, uint16_t>");
+    reportLayout<Packet, std::uint64_t>(json, "Variant<Packet, uint64_t>");
+    reportLayout<Node*, Leaf, Pending>(json, "Variant<Node*, Leaf, Pending>");
+    reportLayout<bool, Leaf>(json, "Variant<bool, Leaf>");
+
+    json.write(std::cout);
+}
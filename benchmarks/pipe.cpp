@@ -0,0 +1,54 @@
+#include "Benchmark.hpp"
+#include "Tuple.hpp"
+#include "TupleAlgorithms.hpp"
+#include <iostream>
+#include <string>
+
+using IDragnev::makeTuple;
+using namespace IDragnev::TupleAlgorithms;
+using namespace IDragnev::Benchmark;
+using namespace IDragnev::Benchmark::StringTuples;
+
+namespace
+{
+    const auto totalSize = [](const auto& t)
+    {
+        return foldl(t, std::size_t{ 0 }, [](auto acc, const auto& s) { return acc + s.size(); });
+    };
+}
+
+int main()
+{
+    const auto source = makeTuple(text, text, text, text, text, text, text, text);
+    auto json = JsonReport{};
+
+    json.add("drop<2>, take<5>, reverse on 8 strings", "one stage at a time", measure([&]
+    {
+        doNotOptimize(source);
+        doNotOptimize(source | drop<2> | take<5> | reverse | totalSize);
+    }, iterations));
+
+    json.add("drop<2>, take<5>, reverse on 8 strings", "the stages composed first", measure([&]
+    {
+        doNotOptimize(source);
+        doNotOptimize(source | (drop<2> | take<5> | reverse) | totalSize);
+    }, iterations));
+
+    json.add("drop<2>, take<5>, reverse on 8 strings", "on a view, materialized once", measure([&]
+    {
+        doNotOptimize(source);
+        doNotOptimize(asView(source) | drop<2> | take<5> | reverse | materialize | totalSize);
+    }, iterations));
+
+    json.add("drop<2>, take<5>, reverse on 8 temporary strings", "one stage at a time", measure([&]
+    {
+        doNotOptimize(makeTuple(text, text, text, text, text, text, text, text) | drop<2> | take<5> | reverse | totalSize);
+    }, iterations / 4));
+
+    json.add("drop<2>, take<5>, reverse on 8 temporary strings", "the stages composed first", measure([&]
+    {
+        doNotOptimize(makeTuple(text, text, text, text, text, text, text, text) | (drop<2> | take<5> | reverse) | totalSize);
+    }, iterations / 4));
+
+    json.write(std::cout);
+}
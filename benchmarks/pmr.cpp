@@ -0,0 +1,50 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    constexpr auto size = std::size_t{ 100'000 };
+    const auto text = "a string too long for the small buffer of std::string";
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    json.add("build and destroy", "global heap", measure([]
+    {
+        auto values = std::vector<IDragnev::Variant<int, std::string>>{};
+        values.reserve(size);
+
+        for (auto i = std::size_t{ 0 }; i < size; ++i)
+        {
+            values.push_back(std::string(text));
+        }
+
+        auto copies = values;
+        doNotOptimize(copies.data());
+    }, 20) / size);
+
+    json.add("build and destroy", "monotonic arena", measure([]
+    {
+        auto arena = std::pmr::monotonic_buffer_resource{};
+        auto values = std::pmr::vector<IDragnev::pmr::Variant<int, std::pmr::string>>(&arena);
+        values.reserve(size);
+
+        for (auto i = std::size_t{ 0 }; i < size; ++i)
+        {
+            values.emplace_back(IDragnev::inPlaceType<std::pmr::string>, text);
+        }
+
+        auto copies = decltype(values)(values, &arena);
+        doNotOptimize(copies.data());
+    }, 20) / size);
+
+    json.write(std::cout);
+}
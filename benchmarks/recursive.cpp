@@ -0,0 +1,118 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+
+using IDragnev::Variant;
+using IDragnev::Box;
+using IDragnev::BoxArena;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    constexpr auto depth = 19;
+    constexpr auto nodes = (std::size_t{ 1 } << (depth + 1)) - 1;
+
+    namespace Boxed
+    {
+        struct Add;
+        using Expression = Variant<double, Box<Add>>;
+
+        struct Add
+        {
+            Expression lhs;
+            Expression rhs;
+        };
+
+        Expression build(BoxArena& arena, int level)
+        {
+            if (level == 0)
+            {
+                return 1.0;
+            }
+
+            return arena.make<Add>(Add{ build(arena, level - 1), build(arena, level - 1) });
+        }
+
+        double evaluate(const Expression& e)
+        {
+            return visit(e, [](const auto& node) -> double
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(node)>, double>)
+                {
+                    return node;
+                }
+                else
+                {
+                    return evaluate(node.lhs) + evaluate(node.rhs);
+                }
+            });
+        }
+    }
+
+    namespace Owned
+    {
+        struct Add;
+        using Expression = Variant<double, std::unique_ptr<Add>>;
+
+        struct Add
+        {
+            Expression lhs;
+            Expression rhs;
+        };
+
+        Expression build(int level)
+        {
+            if (level == 0)
+            {
+                return 1.0;
+            }
+
+            return std::make_unique<Add>(Add{ build(level - 1), build(level - 1) });
+        }
+
+        double evaluate(const Expression& e)
+        {
+            return visit(e, [](const auto& node) -> double
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(node)>, double>)
+                {
+                    return node;
+                }
+                else
+                {
+                    return evaluate(node->lhs) + evaluate(node->rhs);
+                }
+            });
+        }
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    json.add("build, evaluate and destroy", "arena boxes", measure([]
+    {
+        BoxArena arena;
+        const auto tree = Boxed::build(arena, depth);
+        doNotOptimize(Boxed::evaluate(tree));
+    }, 20) / nodes);
+
+    json.add("build, evaluate and destroy", "unique_ptr", measure([]
+    {
+        const auto tree = Owned::build(depth);
+        doNotOptimize(Owned::evaluate(tree));
+    }, 20) / nodes);
+
+    BoxArena arena;
+    const auto boxed = Boxed::build(arena, depth);
+    const auto owned = Owned::build(depth);
+
+    json.add("evaluate", "arena boxes", measure([&] { doNotOptimize(Boxed::evaluate(boxed)); }, 20) / nodes);
+    json.add("evaluate", "unique_ptr", measure([&] { doNotOptimize(Owned::evaluate(owned)); }, 20) / nodes);
+
+    json.write(std::cout);
+}
@@ -0,0 +1,109 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+
+using IDragnev::Variant;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    template <std::size_t I>
+    struct Alternative
+    {
+        Alternative() = default;
+        Alternative(const Alternative& other) : value(other.value + 1) { }
+        Alternative(Alternative&& other) noexcept : value(other.value) { }
+        ~Alternative() { doNotOptimize(value); }
+
+        Alternative& operator=(const Alternative& other) { value = other.value + 1; return *this; }
+        Alternative& operator=(Alternative&& other) noexcept { value = other.value; return *this; }
+
+        unsigned value = I;
+    };
+
+    template <typename Indices>
+    struct MakeVariant;
+
+    template <std::size_t... Is>
+    struct MakeVariant<std::index_sequence<Is...>>
+    {
+        using type = Variant<Alternative<Is>...>;
+    };
+
+    template <std::size_t N>
+    using VariantOf = typename MakeVariant<std::make_index_sequence<N>>::type;
+
+    template <std::size_t N>
+    void run(JsonReport& json)
+    {
+        using V = VariantOf<N>;
+        constexpr auto iterations = std::size_t{ 20'000'000 };
+        const auto suffix = ", " + std::to_string(N) + " alternatives";
+
+        V source = Alternative<N - 1>{};
+        V other = Alternative<0>{};
+        alignas(V) unsigned char buffer[sizeof(V)];
+
+        json.add("copy construct" + suffix, "IDragnev::Variant", measure([&]
+        {
+            doNotOptimize(source);
+            auto* v = new(buffer) V(source);
+            doNotOptimize(*v);
+            v->~V();
+        }, iterations));
+
+        json.add("move construct" + suffix, "IDragnev::Variant", measure([&]
+        {
+            doNotOptimize(source);
+            auto* v = new(buffer) V(std::move(source));
+            doNotOptimize(*v);
+            v->~V();
+        }, iterations));
+
+        json.add("destroy" + suffix, "IDragnev::Variant", measure([&]
+        {
+            auto* v = new(buffer) V(Alternative<N - 1>{});
+            doNotOptimize(*v);
+            v->~V();
+        }, iterations));
+
+        V target = Alternative<N - 1>{};
+
+        json.add("copy assign, same alternative" + suffix, "IDragnev::Variant", measure([&]
+        {
+            doNotOptimize(source);
+            target = source;
+            doNotOptimize(target);
+        }, iterations));
+
+        json.add("move assign, same alternative" + suffix, "IDragnev::Variant", measure([&]
+        {
+            doNotOptimize(source);
+            target = std::move(source);
+            doNotOptimize(target);
+        }, iterations));
+
+        json.add("copy assign, other alternative" + suffix, "IDragnev::Variant", measure([&]
+        {
+            doNotOptimize(source);
+            target = other;
+            target = source;
+            doNotOptimize(target);
+        }, iterations / 2));
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    run<2>(json);
+    run<8>(json);
+    run<32>(json);
+    run<128>(json);
+
+    json.write(std::cout);
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using IDragnev::BasicVariant;
+using IDragnev::InlineStorage;
+using IDragnev::SpillAbove;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Small
+    {
+        int value;
+    };
+
+    struct Huge
+    {
+        int value;
+        char payload[4092];
+    };
+
+    constexpr auto size = std::size_t{ 100'000 };
+
+    //one Huge in every hundred elements
+    bool isHuge(std::size_t i)
+    {
+        return i % 100 == 0;
+    }
+
+    template <typename Policy>
+    void run(JsonReport& json, const std::string& name)
+    {
+        using V = BasicVariant<Policy, Small, Huge>;
+
+        auto values = std::vector<V>{};
+        auto hugeCount = std::size_t{ 0 };
+        values.reserve(size);
+
+        for (auto i = std::size_t{ 0 }; i < size; ++i)
+        {
+            if (isHuge(i))
+            {
+                values.push_back(Huge{ int(i), {} });
+                ++hugeCount;
+            }
+            else
+            {
+                values.push_back(Small{ int(i) });
+            }
+        }
+
+        const auto inlineBytes = values.size() * sizeof(V);
+        const auto spilledBytes = Policy::template spills<Huge> ? hugeCount * sizeof(Huge) : 0;
+
+        json.add("memory of " + std::to_string(size) + " elements", name, { { "element_bytes", sizeof(V) },
+                                                                             { "total_kib", (inlineBytes + spilledBytes) / 1024 } });
+
+        json.add("sum over all elements", name, measure([&]
+        {
+            auto sum = 0ll;
+            for (const auto& v : values)
+            {
+                sum += visit(v, [](const auto& x) { return x.value; });
+            }
+            doNotOptimize(sum);
+        }, 100) / size);
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    run<InlineStorage>(json, "inline");
+    run<SpillAbove<64>>(json, "spill above 64 bytes");
+
+    json.write(std::cout);
+}
@@ -0,0 +1,308 @@
+//Compares IDragnev::Variant with std::variant and with an equivalent class hierarchy
+//with virtual functions, case by case, and writes the results as JSON to the standard output.
+//The suite needs nothing but the headers of the library:
+//  g++ -std=c++17 -O2 -DNDEBUG -Iinclude -Iinclude/variant benchmarks/suite.cpp -o suite
+//  ./suite > results.json
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    constexpr auto iterations = std::size_t{ 5'000'000 };
+    constexpr auto rangeSize = std::size_t{ 4096 };
+    constexpr auto rangeIterations = std::size_t{ 2'000 };
+
+    const auto text = std::string("short text");
+
+    //the same alternatives behind a virtual interface
+    class Value
+    {
+    public:
+        virtual ~Value() = default;
+        virtual std::unique_ptr<Value> clone() const = 0;
+        virtual std::size_t weight() const = 0;
+    };
+
+    template <typename T>
+    class Holder : public Value
+    {
+    public:
+        explicit Holder(T value) : value(std::move(value)) { }
+
+        std::unique_ptr<Value> clone() const override { return std::make_unique<Holder>(*this); }
+        std::size_t weight() const override;
+
+        T value;
+    };
+
+    template <>
+    std::size_t Holder<int>::weight() const { return static_cast<std::size_t>(value); }
+
+    template <>
+    std::size_t Holder<std::string>::weight() const { return value.size(); }
+
+    struct Weight
+    {
+        std::size_t operator()(int x) const { return static_cast<std::size_t>(x); }
+        std::size_t operator()(double x) const { return static_cast<std::size_t>(x); }
+        std::size_t operator()(const std::string& s) const { return s.size(); }
+    };
+
+    using Mine = IDragnev::Variant<int, double, std::string>;
+    using Std = std::variant<int, double, std::string>;
+    using Virtual = std::unique_ptr<Value>;
+
+    //construction and destruction, in a buffer so that only the variant is measured
+    template <typename V, typename Make>
+    double constructAndDestroy(Make make)
+    {
+        alignas(V) unsigned char buffer[sizeof(V)];
+
+        return measure([&]
+        {
+            auto v = new(buffer) V(make());
+            doNotOptimize(*v);
+            v->~V();
+        }, iterations);
+    }
+
+    void construction(JsonReport& json)
+    {
+        json.add("construct and destroy int", "IDragnev::Variant", constructAndDestroy<Mine>([] { return 42; }));
+        json.add("construct and destroy int", "std::variant", constructAndDestroy<Std>([] { return 42; }));
+        json.add("construct and destroy int", "virtual", constructAndDestroy<Virtual>([] { return std::make_unique<Holder<int>>(42); }));
+
+        json.add("construct and destroy string", "IDragnev::Variant", constructAndDestroy<Mine>([] { return text; }));
+        json.add("construct and destroy string", "std::variant", constructAndDestroy<Std>([] { return text; }));
+        json.add("construct and destroy string", "virtual", constructAndDestroy<Virtual>([] { return std::make_unique<Holder<std::string>>(text); }));
+    }
+
+    template <typename V, typename Copy>
+    double copyOf(const V& source, Copy copy)
+    {
+        return measure([&]
+        {
+            doNotOptimize(source);
+            auto v = copy(source);
+            doNotOptimize(v);
+        }, iterations);
+    }
+
+    template <typename V>
+    double moveOf(V source)
+    {
+        return measure([&]
+        {
+            auto v = std::move(source);
+            doNotOptimize(v);
+            source = std::move(v);
+        }, iterations);
+    }
+
+    void copyAndMove(JsonReport& json)
+    {
+        const auto same = [](const auto& v) { return v; };
+        const auto clone = [](const Virtual& v) { return v->clone(); };
+
+        json.add("copy string", "IDragnev::Variant", copyOf(Mine(text), same));
+        json.add("copy string", "std::variant", copyOf(Std(text), same));
+        json.add("copy string", "virtual", copyOf(Virtual(std::make_unique<Holder<std::string>>(text)), clone));
+
+        json.add("move string", "IDragnev::Variant", moveOf(Mine(text)));
+        json.add("move string", "std::variant", moveOf(Std(text)));
+        json.add("move string", "virtual", moveOf(Virtual(std::make_unique<Holder<std::string>>(text))));
+    }
+
+    template <typename V, typename MakeInt, typename MakeString>
+    double assignAcross(MakeInt makeInt, MakeString makeString)
+    {
+        auto v = V(makeInt());
+        auto i = 0u;
+
+        return measure([&]
+        {
+            if (++i % 2 == 0)
+            {
+                v = makeInt();
+            }
+            else
+            {
+                v = makeString();
+            }
+            doNotOptimize(v);
+        }, iterations);
+    }
+
+    void assignment(JsonReport& json)
+    {
+        const auto makeInt = [] { return 42; };
+        const auto makeString = [] { return text; };
+
+        json.add("assign int and string in turn", "IDragnev::Variant", assignAcross<Mine>(makeInt, makeString));
+        json.add("assign int and string in turn", "std::variant", assignAcross<Std>(makeInt, makeString));
+        json.add("assign int and string in turn", "virtual", assignAcross<Virtual>([] { return std::make_unique<Holder<int>>(42); },
+                                                                                   [] { return std::make_unique<Holder<std::string>>(text); }));
+    }
+
+    void access(JsonReport& json)
+    {
+        const auto mine = Mine(42);
+        const auto standard = Std(42);
+        const auto virtualValue = Virtual(std::make_unique<Holder<int>>(42));
+
+        json.add("get int", "IDragnev::Variant", measure([&] { doNotOptimize(mine); doNotOptimize(mine.get<int>()); }, iterations));
+        json.add("get int", "std::variant", measure([&] { doNotOptimize(standard); doNotOptimize(std::get<int>(standard)); }, iterations));
+        json.add("get int", "virtual", measure([&]
+        {
+            doNotOptimize(virtualValue);
+            doNotOptimize(dynamic_cast<const Holder<int>&>(*virtualValue).value);
+        }, iterations));
+    }
+
+    template <std::size_t I>
+    struct Alternative
+    {
+        unsigned value = I;
+    };
+
+    template <std::size_t I>
+    class Node : public Value
+    {
+    public:
+        std::unique_ptr<Value> clone() const override { return std::make_unique<Node>(*this); }
+        std::size_t weight() const override { return value; }
+
+    private:
+        unsigned value = I;
+    };
+
+    template <typename Indices>
+    struct Family;
+
+    template <std::size_t... Is>
+    struct Family<std::index_sequence<Is...>>
+    {
+        using Mine = IDragnev::Variant<Alternative<Is>...>;
+        using Std = std::variant<Alternative<Is>...>;
+
+        template <typename V>
+        static V make(std::size_t i)
+        {
+            using Make = V(*)();
+            static constexpr Make makers[] = { [] { return V(Alternative<Is>{}); }... };
+            return makers[i]();
+        }
+
+        static Virtual makeVirtual(std::size_t i)
+        {
+            using Make = Virtual(*)();
+            static constexpr Make makers[] = { [] { return Virtual(std::make_unique<Node<Is>>()); }... };
+            return makers[i]();
+        }
+    };
+
+    //visits a range of values holding the alternatives chosen by pick
+    template <std::size_t N, typename Pick>
+    void visitRange(JsonReport& json, const std::string& distribution, Pick pick)
+    {
+        using F = Family<std::make_index_sequence<N>>;
+
+        auto mine = std::vector<typename F::Mine>{};
+        auto standard = std::vector<typename F::Std>{};
+        auto virtuals = std::vector<Virtual>{};
+
+        for (auto i = std::size_t{ 0 }; i < rangeSize; ++i)
+        {
+            const auto alternative = pick();
+            mine.push_back(F::template make<typename F::Mine>(alternative));
+            standard.push_back(F::template make<typename F::Std>(alternative));
+            virtuals.push_back(F::makeVirtual(alternative));
+        }
+
+        const auto name = "visit " + std::to_string(N) + " alternatives, " + distribution;
+        const auto valueOf = [](const auto& alternative) { return alternative.value; };
+
+        json.add(name, "IDragnev::Variant", measure([&]
+        {
+            auto sum = std::size_t{ 0 };
+            for (const auto& v : mine)
+            {
+                sum += IDragnev::visit(v, valueOf);
+            }
+            doNotOptimize(sum);
+        }, rangeIterations) / rangeSize);
+
+        json.add(name, "std::variant", measure([&]
+        {
+            auto sum = std::size_t{ 0 };
+            for (const auto& v : standard)
+            {
+                sum += std::visit(valueOf, v);
+            }
+            doNotOptimize(sum);
+        }, rangeIterations) / rangeSize);
+
+        json.add(name, "virtual", measure([&]
+        {
+            auto sum = std::size_t{ 0 };
+            for (const auto& v : virtuals)
+            {
+                sum += v->weight();
+            }
+            doNotOptimize(sum);
+        }, rangeIterations) / rangeSize);
+    }
+
+    template <std::size_t N>
+    void visitDistributions(JsonReport& json)
+    {
+        auto engine = std::mt19937{ 42 };
+        auto uniform = std::uniform_int_distribution<std::size_t>{ 0, N - 1 };
+        //nine in ten values hold the first alternative
+        auto skewed = std::discrete_distribution<std::size_t>{ { 9.0, 1.0 } };
+        auto rest = std::uniform_int_distribution<std::size_t>{ 1, N - 1 };
+
+        visitRange<N>(json, "single alternative", [] { return N - 1; });
+        visitRange<N>(json, "skewed", [&] { return skewed(engine) == 0 ? 0 : rest(engine); });
+        visitRange<N>(json, "uniform", [&] { return uniform(engine); });
+    }
+
+    void visiting(JsonReport& json)
+    {
+        visitDistributions<2>(json);
+        visitDistributions<8>(json);
+        visitDistributions<32>(json);
+
+        const auto mine = Mine(text);
+        const auto standard = Std(text);
+        const auto virtualValue = Virtual(std::make_unique<Holder<std::string>>(text));
+
+        json.add("visit one value", "IDragnev::Variant", measure([&] { doNotOptimize(mine); doNotOptimize(IDragnev::visit(mine, Weight{})); }, iterations));
+        json.add("visit one value", "std::variant", measure([&] { doNotOptimize(standard); doNotOptimize(std::visit(Weight{}, standard)); }, iterations));
+        json.add("visit one value", "virtual", measure([&] { doNotOptimize(virtualValue); doNotOptimize(virtualValue->weight()); }, iterations));
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    construction(json);
+    copyAndMove(json);
+    assignment(json);
+    access(json);
+    visiting(json);
+
+    json.write(std::cout);
+}
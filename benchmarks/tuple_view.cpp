@@ -0,0 +1,80 @@
+#include "Benchmark.hpp"
+#include "Tuple.hpp"
+#include "TupleAlgorithms.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+using IDragnev::makeTuple;
+using namespace IDragnev::TupleAlgorithms;
+using namespace IDragnev::Benchmark;
+using namespace IDragnev::Benchmark::StringTuples;
+
+namespace
+{
+    std::size_t allocations = 0;
+
+    template <typename Pipeline>
+    void run(JsonReport& json, const std::string& name, Pipeline pipeline)
+    {
+        const auto before = allocations;
+        pipeline();
+        const auto perRun = allocations - before;
+
+        const auto ns = measure(pipeline, iterations);
+        json.add("take<6> | drop<2> | reverse on a tuple of 8 strings", name, { { "ns_per_op", ns }, { "allocations", perRun } });
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (auto p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main()
+{
+    const auto source = makeTuple(text, text, text, text, text, text, text, text);
+    const auto totalSize = [](const auto& t)
+    {
+        return foldl(t, std::size_t{ 0 }, [](auto acc, const auto& s) { return acc + s.size(); });
+    };
+
+    auto json = JsonReport{};
+
+    run(json, "on the tuple", [&]
+    {
+        doNotOptimize(source);
+        doNotOptimize(source | take<6> | drop<2> | reverse | totalSize);
+    });
+
+    run(json, "on a view", [&]
+    {
+        doNotOptimize(source);
+        doNotOptimize(asView(source) | take<6> | drop<2> | reverse | totalSize);
+    });
+
+    run(json, "on a view, materialized", [&]
+    {
+        doNotOptimize(source);
+        const auto result = asView(source) | take<6> | drop<2> | reverse | materialize;
+        doNotOptimize(result);
+    });
+
+    json.write(std::cout);
+}
@@ -0,0 +1,191 @@
+#include "Benchmark.hpp"
+#include "VariantRing.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+using IDragnev::Variant;
+using IDragnev::VariantRing;
+using IDragnev::visit;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Order
+    {
+        std::int64_t id;
+        double price;
+        std::int32_t quantity;
+    };
+
+    struct Cancel
+    {
+        std::int64_t id;
+    };
+
+    using Message = Variant<Order, Cancel>;
+
+    constexpr auto messagesCount = std::size_t{ 1'000'000 };
+    constexpr auto capacity = std::size_t{ 1024 };
+
+    struct Sum
+    {
+        std::int64_t operator()(const Order& o) const { return o.id + o.quantity; }
+        std::int64_t operator()(const Cancel& c) const { return c.id; }
+    };
+
+    //the queue the ring replaces: a mutex around std::queue, copying each message in and out
+    class LockedQueue
+    {
+    public:
+        bool tryPush(const Message& m)
+        {
+            auto lock = std::lock_guard<std::mutex>{ mutex };
+            if (queue.size() == capacity)
+            {
+                return false;
+            }
+            queue.push(m);
+            return true;
+        }
+
+        bool tryPop(Message& m)
+        {
+            auto lock = std::lock_guard<std::mutex>{ mutex };
+            if (queue.empty())
+            {
+                return false;
+            }
+            m = queue.front();
+            queue.pop();
+            return true;
+        }
+
+    private:
+        std::mutex mutex;
+        std::queue<Message> queue;
+    };
+
+    //runs threads producers and as many consumers over messagesCount messages
+    template <typename Produce, typename Consume>
+    void throughput(JsonReport& json, const std::string& name, std::size_t threads, Produce produce, Consume consume)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        auto consumed = std::atomic<std::size_t>{ 0 };
+        auto workers = std::vector<std::thread>{};
+        const auto perProducer = messagesCount / threads;
+        const auto total = perProducer * threads;
+
+        const auto start = Clock::now();
+
+        for (auto p = std::size_t{ 0 }; p < threads; ++p)
+        {
+            workers.emplace_back([&, p]
+            {
+                for (auto i = std::size_t{ 0 }; i < perProducer; ++i)
+                {
+                    produce(static_cast<std::int64_t>(p * perProducer + i));
+                }
+            });
+        }
+
+        for (auto c = std::size_t{ 0 }; c < threads; ++c)
+        {
+            workers.emplace_back([&]
+            {
+                auto sum = std::int64_t{ 0 };
+
+                while (consumed.load(std::memory_order_relaxed) < total)
+                {
+                    if (consume(sum))
+                    {
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                doNotOptimize(sum);
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        const auto messages = static_cast<double>(total);
+        json.add("pass messages, " + std::to_string(threads) + " producers and consumers", name,
+                 { { "ns_per_op", seconds * 1e9 / messages }, { "mmsgs_per_s", messages / seconds / 1e6 } });
+    }
+
+    void ring(JsonReport& json, std::size_t threads)
+    {
+        auto queue = VariantRing<Order, Cancel>(capacity);
+
+        throughput(json, "VariantRing", threads, [&queue](std::int64_t id)
+        {
+            if (id % 4 == 0)
+            {
+                queue.emplace<Cancel>(Cancel{ id });
+            }
+            else
+            {
+                queue.emplace<Order>(Order{ id, 1.5, 10 });
+            }
+        },
+        [&queue](std::int64_t& sum)
+        {
+            return queue.tryConsume([&sum](const auto& m) { sum += Sum{}(m); });
+        });
+    }
+
+    void locked(JsonReport& json, std::size_t threads)
+    {
+        auto queue = LockedQueue{};
+
+        throughput(json, "mutex and std::queue", threads, [&queue](std::int64_t id)
+        {
+            const auto message = (id % 4 == 0) ? Message(Cancel{ id }) : Message(Order{ id, 1.5, 10 });
+            while (!queue.tryPush(message))
+            {
+                std::this_thread::yield();
+            }
+        },
+        [&queue](std::int64_t& sum)
+        {
+            auto message = Message{};
+            if (!queue.tryPop(message))
+            {
+                return false;
+            }
+            sum += visit(message, Sum{});
+            return true;
+        });
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    json.add("machine", "", { { "hardware_threads", std::thread::hardware_concurrency() } });
+
+    for (const auto threads : { 1u, 2u, 4u, 8u, 16u })
+    {
+        ring(json, threads);
+        locked(json, threads);
+    }
+
+    json.write(std::cout);
+}
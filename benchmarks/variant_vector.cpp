@@ -0,0 +1,94 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include "VariantVector.hpp"
+#include <iostream>
+#include <vector>
+
+using IDragnev::Variant;
+using IDragnev::VariantVector;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Small
+    {
+        int value;
+    };
+
+    struct Huge
+    {
+        int value;
+        char payload[252];
+    };
+
+    constexpr auto size = std::size_t{ 1'000'000 };
+
+    //one Huge in every sixteen elements
+    bool isHuge(std::size_t i)
+    {
+        return i % 16 == 0;
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+    auto variants = std::vector<Variant<Small, Huge>>{};
+    auto columns = VariantVector<Small, Huge>{};
+
+    for (auto i = std::size_t{ 0 }; i < size; ++i)
+    {
+        if (isHuge(i))
+        {
+            variants.push_back(Huge{ int(i), {} });
+            columns.pushBack(Huge{ int(i), {} });
+        }
+        else
+        {
+            variants.push_back(Small{ int(i) });
+            columns.pushBack(Small{ int(i) });
+        }
+    }
+
+    json.add("sum of Small", "vector of Variant", measure([&]
+    {
+        auto sum = 0ll;
+        for (const auto& v : variants)
+        {
+            if (v.is<Small>())
+            {
+                sum += v.get<Small>().value;
+            }
+        }
+        doNotOptimize(sum);
+    }, 20) / size);
+
+    json.add("sum of Small", "VariantVector::forEachOf", measure([&]
+    {
+        auto sum = 0ll;
+        columns.forEachOf<Small>([&sum](const Small& s) { sum += s.value; });
+        doNotOptimize(sum);
+    }, 20) / size);
+
+    json.add("visit each element", "vector of Variant", measure([&]
+    {
+        auto sum = 0ll;
+        for (const auto& v : variants)
+        {
+            sum += visit([](const auto& x) { return x.value; }, v);
+        }
+        doNotOptimize(sum);
+    }, 20) / size);
+
+    json.add("visit each element", "VariantVector::visit", measure([&]
+    {
+        auto sum = 0ll;
+        for (auto i = std::size_t{ 0 }; i < columns.size(); ++i)
+        {
+            sum += columns.visit(i, [](const auto& x) { return x.value; });
+        }
+        doNotOptimize(sum);
+    }, 20) / size);
+
+    json.write(std::cout);
+}
@@ -0,0 +1,64 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+using IDragnev::Variant;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    //same layout as Point, but with a user-provided copy constructor
+    struct CopyablePoint
+    {
+        CopyablePoint(int x, int y) : x(x), y(y) { }
+        CopyablePoint(const CopyablePoint& other) : x(other.x), y(other.y) { }
+
+        int x;
+        int y;
+    };
+
+    template <typename V, typename MakeValue>
+    void growVector(JsonReport& json, const std::string& alternatives, MakeValue make)
+    {
+        constexpr auto size = std::size_t{ 1'000'000 };
+
+        const auto ns = measure([&]
+        {
+            auto values = std::vector<V>{};
+
+            for (auto i = std::size_t{ 0 }; i < size; ++i)
+            {
+                values.push_back(make(i));
+            }
+
+            doNotOptimize(values.data());
+        }, 50);
+
+        json.add("push_back", alternatives, ns / size);
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    growVector<Variant<int, float, Point>>(json, "trivially copyable alternatives", [](std::size_t i)
+    {
+        return Point{ int(i), int(i) };
+    });
+
+    growVector<Variant<int, float, CopyablePoint>>(json, "non-trivially copyable alternative", [](std::size_t i)
+    {
+        return CopyablePoint{ int(i), int(i) };
+    });
+
+    json.write(std::cout);
+}
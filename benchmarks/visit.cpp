@@ -0,0 +1,102 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include <iostream>
+#include <string>
+#include <utility>
+
+using IDragnev::Variant;
+using IDragnev::visit;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    template <std::size_t I>
+    struct Alternative
+    {
+        unsigned value = I;
+    };
+
+    template <typename Indices>
+    struct MakeVariant;
+
+    template <std::size_t... Is>
+    struct MakeVariant<std::index_sequence<Is...>>
+    {
+        using type = Variant<Alternative<Is>...>;
+    };
+
+    template <std::size_t N>
+    using VariantOf = typename MakeVariant<std::make_index_sequence<N>>::type;
+
+    template <std::size_t N, std::size_t I>
+    void visitAlternative(JsonReport& json, const char* position)
+    {
+        VariantOf<N> v = Alternative<I>{};
+        auto sum = 0u;
+
+        const auto ns = measure([&]
+        {
+            doNotOptimize(v);
+            sum += visit(v, [](const auto& alternative) { return alternative.value; });
+            doNotOptimize(sum);
+        }, 50'000'000);
+
+        json.add("visit " + std::to_string(N) + " alternatives, " + position, "IDragnev::Variant", ns);
+    }
+
+    template <std::size_t N>
+    void visitFirstAndLast(JsonReport& json)
+    {
+        visitAlternative<N, 0>(json, "first");
+        visitAlternative<N, N - 1>(json, "last");
+    }
+
+    template <std::size_t N>
+    void visitPair(JsonReport& json)
+    {
+        VariantOf<N> u = Alternative<N - 1>{};
+        VariantOf<N> v = Alternative<N / 2>{};
+        auto sum = 0u;
+        const auto add = [](const auto& x, const auto& y) { return x.value + y.value; };
+
+        const auto nested = measure([&]
+        {
+            doNotOptimize(u);
+            doNotOptimize(v);
+            sum += visit(u, [&](const auto& x)
+            {
+                return visit(v, [&](const auto& y) { return add(x, y); });
+            });
+            doNotOptimize(sum);
+        }, 20'000'000);
+
+        const auto flat = measure([&]
+        {
+            doNotOptimize(u);
+            doNotOptimize(v);
+            sum += visit(add, u, v);
+            doNotOptimize(sum);
+        }, 20'000'000);
+
+        const auto name = "visit 2 variants of " + std::to_string(N) + " alternatives";
+        json.add(name, "nested visit", nested);
+        json.add(name, "visit of both", flat);
+    }
+}
+
+int main()
+{
+    auto json = JsonReport{};
+
+    visitFirstAndLast<2>(json);
+    visitFirstAndLast<8>(json);
+    visitFirstAndLast<16>(json);
+    visitFirstAndLast<32>(json);
+    visitFirstAndLast<64>(json);
+
+    visitPair<4>(json);
+    visitPair<16>(json);
+    visitPair<32>(json);
+
+    json.write(std::cout);
+}
@@ -0,0 +1,102 @@
+#include "Benchmark.hpp"
+#include "Variant.hpp"
+#include "VisitAll.hpp"
+#include <iostream>
+#include <random>
+#include <vector>
+
+using IDragnev::Variant;
+using namespace IDragnev::Benchmark;
+
+namespace
+{
+    struct Circle
+    {
+        float r;
+    };
+
+    struct Square
+    {
+        float a;
+    };
+
+    struct Rectangle
+    {
+        float a;
+        float b;
+    };
+
+    struct Area
+    {
+        float operator()(const Circle& c) const { return 3.14159f * c.r * c.r; }
+        float operator()(const Square& s) const { return s.a * s.a; }
+        float operator()(const Rectangle& r) const { return r.a * r.b; }
+    };
+
+    using Shape = Variant<Circle, Square, Rectangle>;
+
+    std::vector<Shape> randomShapes(std::size_t size)
+    {
+        auto engine = std::mt19937{ 42 };
+        auto kind = std::uniform_int_distribution<int>{ 0, 2 };
+        auto shapes = std::vector<Shape>{};
+        shapes.reserve(size);
+
+        for (auto i = std::size_t{ 0 }; i < size; ++i)
+        {
+            const auto x = float(i % 100);
+
+            switch (kind(engine))
+            {
+            case 0: shapes.push_back(Circle{ x }); break;
+            case 1: shapes.push_back(Square{ x }); break;
+            default: shapes.push_back(Rectangle{ x, x + 1 }); break;
+            }
+        }
+
+        return shapes;
+    }
+}
+
+int main()
+{
+    constexpr auto size = std::size_t{ 1'000'000 };
+    const auto shapes = randomShapes(size);
+    auto json = JsonReport{};
+
+    json.add("sum of areas", "visit per element", measure([&]
+    {
+        auto sum = 0.0f;
+        for (const auto& s : shapes)
+        {
+            sum += visit(Area{}, s);
+        }
+        doNotOptimize(sum);
+    }, 50) / size);
+
+    json.add("sum of areas", "visitAll", measure([&]
+    {
+        auto sum = 0.0f;
+        IDragnev::visitAll(shapes, [&sum](const auto& s) { sum += Area{}(s); });
+        doNotOptimize(sum);
+    }, 50) / size);
+
+    json.add("areas in order", "visit per element", measure([&]
+    {
+        auto areas = std::vector<float>{};
+        areas.reserve(shapes.size());
+        for (const auto& s : shapes)
+        {
+            areas.push_back(visit(Area{}, s));
+        }
+        doNotOptimize(areas.data());
+    }, 50) / size);
+
+    json.add("areas in order", "visitAllInOrder", measure([&]
+    {
+        auto areas = IDragnev::visitAllInOrder(shapes, Area{});
+        doNotOptimize(areas.data());
+    }, 50) / size);
+
+    json.write(std::cout);
+}
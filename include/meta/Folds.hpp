@@ -1,3 +1,5 @@
+#pragma once
+
 namespace IDragnev::Meta::Folds
 {
     template <template <typename> typename Predicate,
@@ -4,14 +4,148 @@
 #include "TypeList.hpp"
 #include "ValueList.hpp"
 #include "Pair.hpp"
+#include <cstddef>
+#include <utility>
 
 namespace IDragnev::Meta
 {
-    template <typename List, std::size_t N>
+    //helpers which look through a whole pack at once instead of recursing on its tail,
+    //so that lists of thousands of types do not hit the template instantiation depth limit
+    namespace Detail
+    {
+        template <typename T, typename... Types>
+        constexpr std::size_t findFirst() noexcept
+        {
+            constexpr bool matches[] = { std::is_same_v<T, Types>..., true };
+
+            auto result = std::size_t{ 0 };
+            while (!matches[result])
+            {
+                ++result;
+            }
+
+            return result;
+        }
+
+        template <typename... Types>
+        constexpr std::size_t findLargest() noexcept
+        {
+            constexpr std::size_t sizes[] = { sizeof(Types)... };
+
+            auto result = std::size_t{ 0 };
+            for (auto i = std::size_t{ 1 }; i < sizeof...(Types); ++i)
+            {
+                if (sizes[i] > sizes[result])
+                {
+                    result = i;
+                }
+            }
+
+            return result;
+        }
+
+        template <std::size_t I, typename T>
+        struct IndexedType
+        {
+            using type = T;
+        };
+
+        template <typename Indices, typename... Types>
+        struct IndexedTypes;
+
+        template <std::size_t... Indices, typename... Types>
+        struct IndexedTypes<std::index_sequence<Indices...>, Types...> : IndexedType<Indices, Types>... { };
+
+        template <std::size_t I, typename T>
+        IndexedType<I, T> typeAt(const IndexedType<I, T>&);
+
+        template <std::size_t I, typename... Types>
+        using TypeAt = typename decltype(typeAt<I>(std::declval<IndexedTypes<std::index_sequence_for<Types...>, Types...>>()))::type;
+
+        template <std::size_t Position, std::size_t Size>
+        struct FoundPositionT : std::integral_constant<std::size_t, Position> { };
+
+        template <std::size_t Size>
+        struct FoundPositionT<Size, Size> { };
+
+        template <typename T, std::size_t I>
+        std::integral_constant<std::size_t, I> positionOf(const IndexedType<I, T>&);
+
+        //IndexedTypes is instantiated once per list, after which each lookup of T is
+        //a single overload resolution against its bases. The lookup fails when T
+        //is not in the list or is in it more than once, which is left to findFirst.
+        template <typename T, typename... Types>
+        using DistinctPosition = decltype(positionOf<T>(std::declval<IndexedTypes<std::index_sequence_for<Types...>, Types...>>()));
+
+        template <typename T, typename List>
+        struct FirstPositionT;
+
+        template <typename T,
+                  template <typename...> typename List,
+                  typename... Types
+        > struct FirstPositionT<T, List<Types...>> :
+            FoundPositionT<findFirst<T, Types...>(), sizeof...(Types)>
+        { };
+
+        template <typename T, typename List, typename = std::void_t<>>
+        struct PositionT : FirstPositionT<T, List> { };
+
+        template <typename T,
+                  template <typename...> typename List,
+                  typename... Types
+        > struct PositionT<T, List<Types...>, std::void_t<DistinctPosition<T, Types...>>> :
+            DistinctPosition<T, Types...>
+        { };
+
+        template <typename T, typename List, typename = std::void_t<>>
+        struct IsFoundT : std::false_type { };
+
+        template <typename T, typename List>
+        struct IsFoundT<T, List, std::void_t<decltype(PositionT<T, List>::value)>> : std::true_type { };
+    }
+
+    template <typename List, std::size_t N, bool = isEmpty<List>>
     struct ListRefT : ListRefT<Tail<List>, N - 1> { };
 
     template <typename List>
-    struct ListRefT<List, 0> : HeadT<List> { };
+    struct ListRefT<List, 0, false> : HeadT<List> { };
+
+    template <typename List, std::size_t N>
+    struct ListRefT<List, N, true> { };
+
+    template <template <typename...> typename List,
+              typename... Types,
+              std::size_t N
+    > struct ListRefT<List<Types...>, N, false>
+    {
+        static_assert(N < sizeof...(Types), "ListRef past the end of the list");
+        using type = Detail::TypeAt<N, Types...>;
+    };
+
+    template <template <typename...> typename List,
+              typename... Types
+    > struct ListRefT<List<Types...>, 0, false>
+    {
+        using type = Detail::TypeAt<0, Types...>;
+    };
+
+    template <typename T,
+              T... Values,
+              std::size_t N
+    > struct ListRefT<ValueList<T, Values...>, N, false>
+    {
+    private:
+        static_assert(N < sizeof...(Values), "ListRef past the end of the list");
+        static constexpr T values[] = { Values... };
+
+    public:
+        static constexpr T value = values[N];
+        using type = CTValue<T, value>;
+    };
+
+    template <typename T,
+              T... Values
+    > struct ListRefT<ValueList<T, Values...>, 0, false> : HeadT<ValueList<T, Values...>> { };
 
     template <typename List, std::size_t N>
     using ListRef = typename ListRefT<List, N>::type;
@@ -36,6 +170,13 @@ namespace IDragnev::Meta
               typename List,
               std::size_t Result
     > struct IndexOfT<T, List, Result, true> { };
+
+    template <typename T,
+              template <typename...> typename List,
+              typename... Types
+    > struct IndexOfT<T, List<Types...>, 0, false> : Detail::PositionT<T, List<Types...>>
+    {
+    };
     
     template <typename T, typename List>
     using IndexOf = typename IndexOfT<T, List>::type;
@@ -135,6 +276,13 @@ namespace IDragnev::Meta
     template <typename List>
     struct LargestTypeT<List, true> { };
 
+    template <template <typename...> typename List,
+              typename... Types
+    > struct LargestTypeT<List<Types...>, false>
+    {
+        using type = Detail::TypeAt<Detail::findLargest<Types...>(), Types...>;
+    };
+
     template <typename List>
     using LargestType = typename LargestTypeT<List>::type;
 
@@ -226,35 +374,36 @@ namespace IDragnev::Meta
     template <std::size_t I, typename List>
     using SplitAt = typename SplitAtT<I, List>::type;
 
-    template <std::size_t Size, typename Result = ValueList<std::size_t>>
-    struct MakeIndexListT :
-        MakeIndexListT<Size - 1,
-                       InsertFront<Result, CTValue<std::size_t, Size - 1>>>
-    { };
-
-    template <typename Result>
-    struct MakeIndexListT<0, Result>
+    namespace Detail
     {
-        using type = Result;
-    };
+        //std::make_index_sequence is built by a compiler intrinsic, without recursion
+        template <typename Sequence>
+        struct IndexListFromT;
+
+        template <std::size_t... Is>
+        struct IndexListFromT<std::index_sequence<Is...>>
+        {
+            using type = ValueList<std::size_t, Is...>;
+        };
+
+        template <auto Value, typename Sequence>
+        struct ReplicateFromT;
+
+        template <auto Value, std::size_t... Is>
+        struct ReplicateFromT<Value, std::index_sequence<Is...>>
+        {
+            using type = ValueList<decltype(Value), (static_cast<void>(Is), Value)...>;
+        };
+    }
+
+    template <std::size_t Size>
+    struct MakeIndexListT : Detail::IndexListFromT<std::make_index_sequence<Size>> { };
 
     template <std::size_t N>
     using MakeIndexList = typename MakeIndexListT<N>::type;
 
-    template <auto Value,
-              std::size_t Count,
-              typename Result = ValueList<decltype(Value)>
-    > struct ReplicateValueT :
-        ReplicateValueT<Value,
-                        Count - 1,
-                        InsertFront<Result, CTValue<decltype(Value), Value>>>
-    { };
-
-    template <auto Value, typename Result>
-    struct ReplicateValueT<Value, 0, Result>
-    {
-        using type = Result;
-    };
+    template <auto Value, std::size_t Count>
+    struct ReplicateValueT : Detail::ReplicateFromT<Value, std::make_index_sequence<Count>> { };
 
     template <auto V, std::size_t Count>
     using ReplicateValue = typename ReplicateValueT<V, Count>::type;
@@ -382,6 +531,13 @@ namespace IDragnev::Meta
         static inline constexpr bool value = Result::value;
     };
 
+    template <typename T,
+              template <typename...> typename List,
+              typename... Types
+    > struct IsMemberT<T, List<Types...>, false> : Detail::IsFoundT<T, List<Types...>>
+    {
+    };
+
     template <typename List, bool = isEmpty<List>>
     struct MakeSetT;
 
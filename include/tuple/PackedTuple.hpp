@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Tuple.hpp"
+
+namespace IDragnev
+{
+    template <typename... Types>
+    class PackedTuple;
+
+    template <>
+    struct Meta::IsEmpty<PackedTuple<>> : std::true_type { };
+
+    namespace Detail
+    {
+        template <typename... Types>
+        struct TupleSize<PackedTuple<Types...>> : Meta::CTValue<std::size_t, sizeof...(Types)> { };
+
+        //The order in which the components of PackedTuple<Types...> are stored:
+        //by decreasing alignment, then by decreasing size, so that no component needs padding before it.
+        //Components which compare equal keep their declaration order.
+        template <typename... Types>
+        struct PackedOrderT
+        {
+        private:
+            using Components = Meta::TypeList<Types...>;
+
+            template <typename I, typename J>
+            struct PacksBefore;
+
+            template <std::size_t I, std::size_t J>
+            struct PacksBefore<Meta::CTValue<std::size_t, I>, Meta::CTValue<std::size_t, J>>
+            {
+            private:
+                using U = Meta::ListRef<Components, I>;
+                using V = Meta::ListRef<Components, J>;
+
+            public:
+                static constexpr bool value = (alignof(U) != alignof(V)) ? (alignof(U) > alignof(V)) :
+                                              (sizeof(U) != sizeof(V))   ? (sizeof(U) > sizeof(V)) :
+                                                                           (I < J);
+            };
+
+        public:
+            using type = Meta::InsertionSort<Meta::MakeIndexList<sizeof...(Types)>, PacksBefore>;
+        };
+
+        template <typename Order, typename... Types>
+        struct PackedStorageT;
+
+        //the components are the bases of the storage in the packed order,
+        //each one still labeled by its index in Types
+        template <std::size_t... Indices, typename... Types>
+        struct PackedStorageT<Meta::ValueList<std::size_t, Indices...>, Types...>
+        {
+            using type = TupleStorage<std::index_sequence<Indices...>, Meta::ListRef<Meta::TypeList<Types...>, Indices>...>;
+        };
+
+        template <typename... Types>
+        using PackedStorage = typename PackedStorageT<typename PackedOrderT<Types...>::type, Types...>::type;
+    } //namespace Detail
+
+    //A tuple which stores its components in the order taking the least space
+    //(see Detail::PackedOrderT), while get<I> still refers to the I-th of Types.
+    //PackedTuple<char, double, char, int> takes 16 bytes instead of the 24 of Tuple<char, double, char, int>.
+    template <typename... Types>
+    class PackedTuple : private Detail::PackedStorage<Types...>
+    {
+    private:
+        using Storage = Detail::PackedStorage<Types...>;
+
+        template <typename... Args>
+        using EnableIfComponents = std::enable_if_t<sizeof...(Args) == sizeof...(Types) && sizeof...(Types) != 0 &&
+                                                    !(sizeof...(Args) == 1 && (std::is_same_v<std::decay_t<Args>, PackedTuple> && ...))>;
+
+    public:
+        PackedTuple() = default;
+        PackedTuple(PackedTuple&& source) = default;
+        PackedTuple(const PackedTuple& source) = default;
+        ~PackedTuple() = default;
+
+        //the arguments are given in the order of Types and forwarded to the components in the packed order
+        template <typename... Args,
+                  typename = EnableIfComponents<Args...>
+        > constexpr PackedTuple(Args&&... args) :
+            Storage(Detail::FromTuple{}, Tuple<Args&&...>(std::forward<Args>(args)...))
+        {
+        }
+
+        PackedTuple& operator=(PackedTuple&& rhs) = default;
+        PackedTuple& operator=(const PackedTuple& rhs) = default;
+
+        template <std::size_t Index, typename TupleT, std::size_t Size>
+        friend constexpr decltype(auto) get(TupleT&& tuple) noexcept;
+    };
+
+    template <>
+    class PackedTuple<> { };
+
+    template <typename... Types>
+    inline constexpr
+    auto makePackedTuple(Types&&... args)
+    {
+        using T = PackedTuple<std::decay_t<Types>...>;
+        return T(std::forward<Types>(args)...);
+    }
+
+    template <typename... Us,
+              typename... Vs,
+              typename = Detail::EnableIfHaveSameLength<Meta::TypeList<Us...>, Meta::TypeList<Vs...>>
+    > inline constexpr
+    bool operator==(const PackedTuple<Us...>& u, const PackedTuple<Vs...>& v)
+    {
+        return Detail::compareWith(std::equal_to{}, u, v, std::index_sequence_for<Us...>{});
+    }
+
+    template <typename... Us,
+              typename... Vs,
+              typename = Detail::EnableIfHaveSameLength<Meta::TypeList<Us...>, Meta::TypeList<Vs...>>
+    > inline constexpr
+    bool operator!=(const PackedTuple<Us...>& u, const PackedTuple<Vs...>& v)
+    {
+        return !(u == v);
+    }
+} //namespace IDragnev
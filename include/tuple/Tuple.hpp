@@ -10,8 +10,20 @@ namespace IDragnev
     template <typename... Types>
     class Tuple;
 
+    template <typename Source, std::size_t... Indices>
+    class TupleView;
+
     namespace Detail
     {
+        template <typename T>
+        struct IsTupleView : std::false_type { };
+
+        template <typename Source, std::size_t... Indices>
+        struct IsTupleView<TupleView<Source, Indices...>> : std::true_type { };
+
+        template <typename T>
+        inline constexpr bool isTupleView = IsTupleView<std::decay_t<T>>::value;
+
         template <typename TupleT>
         struct TupleSize { };
 
@@ -34,11 +46,17 @@ namespace IDragnev
     template <std::size_t Index,
               typename TupleT,
               std::size_t Size = tupleSize<TupleT>
-    > inline constexpr
+    > IDRAGNEV_ALWAYS_INLINE constexpr
     decltype(auto) get(TupleT&& tuple) noexcept
     {
         static_assert(Index < Size, "Tuple index out of range");
-        return Detail::getValue<Size - Index - 1>(std::forward<TupleT>(tuple));
+
+        if constexpr (Detail::isTupleView<TupleT>) {
+            return tuple.template get<Index>();
+        }
+        else {
+            return Detail::getValue<Index>(std::forward<TupleT>(tuple));
+        }
     }
     
     template <typename T,
@@ -52,21 +70,63 @@ namespace IDragnev
         return get<index>(std::forward<TupleT>(tuple));
     }
 
+    namespace Detail
+    {
+        struct FromComponents { };
+        struct FromTuple { };
+
+        template <typename IndexSequence, typename... Types>
+        class TupleStorage;
+
+        //all components are direct bases, a tuple of N components is a single class
+        //instead of N nested ones and needs no chain of base conversions to reach any of them
+        template <std::size_t... Indices, typename... Types>
+        class TupleStorage<std::index_sequence<Indices...>, Types...>
+            : public TupleElement<Indices, Types>...
+        {
+        public:
+            TupleStorage() = default;
+
+            template <typename... Args>
+            constexpr TupleStorage(FromComponents, Args&&... args) :
+                TupleElement<Indices, Types>(std::forward<Args>(args))...
+            {
+            }
+
+            template <typename TupleT>
+            constexpr TupleStorage(FromTuple, TupleT&& source) :
+                TupleElement<Indices, Types>(IDragnev::get<Indices>(std::forward<TupleT>(source)))...
+            {
+            }
+
+            template <typename TupleT>
+            constexpr void assign(TupleT&& source)
+            {
+                ((getValue<Indices>(*this) = IDragnev::get<Indices>(std::forward<TupleT>(source))), ...);
+            }
+        };
+    } //namespace Detail
+
     template <>
     class Tuple<> { };
 
     template <typename Head, typename... Tail>
     class Tuple<Head, Tail...>
-        : private Detail::TupleElement<sizeof...(Tail), Head>,
-          private Tuple<Tail...>
+        : private Detail::TupleStorage<std::index_sequence_for<Head, Tail...>, Head, Tail...>
     {
     private:
-        using HeadElement = Detail::TupleElement<sizeof...(Tail), Head>;
+        using Storage = Detail::TupleStorage<std::index_sequence_for<Head, Tail...>, Head, Tail...>;
         using TailTuple = Tuple<Tail...>;
 
         template <typename... Args>
         using EnableIfMatchesTailLength = std::enable_if_t<sizeof...(Args) == sizeof...(Tail)>;
 
+        //a one-component tuple is constructed from Source as a whole if it can be,
+        //otherwise Tuple<Tuple<int>&&> would bind its reference to a temporary made of the int
+        template <typename Source, typename... VTail>
+        using EnableIfConvertsComponentwise = std::enable_if_t<sizeof...(VTail) == sizeof...(Tail) &&
+                                                               !(sizeof...(Tail) == 0 && std::is_constructible_v<Head, Source>)>;
+
     public:
         Tuple() = default;
         Tuple(Tuple&& source) = default;
@@ -80,12 +140,12 @@ namespace IDragnev
 
         template <typename VHead,
                   typename... VTail,
-                  typename = EnableIfMatchesTailLength<VTail...>
+                  typename = EnableIfConvertsComponentwise<const Tuple<VHead, VTail...>&, VTail...>
         > constexpr Tuple(const Tuple<VHead, VTail...>& source);
 
         template <typename VHead,
                   typename... VTail,
-                  typename = EnableIfMatchesTailLength<VTail...>
+                  typename = EnableIfConvertsComponentwise<Tuple<VHead, VTail...>&&, VTail...>
         > constexpr Tuple(Tuple<VHead, VTail...>&& source);
 
         Tuple& operator=(Tuple&& rhs) = default;
@@ -105,14 +165,24 @@ namespace IDragnev
         constexpr Head&& getHead() && noexcept;
         constexpr const Head& getHead() const& noexcept;
 
-        constexpr TailTuple& getTail() & noexcept;
-        constexpr TailTuple&& getTail() && noexcept;
-        constexpr const TailTuple& getTail() const& noexcept;
+        //A view of the tail of an lvalue tuple and the moved tail of an rvalue one.
+        //The view assigns and compares the components of the tail, as Tuple<Tail...>& would.
+        constexpr auto getTail() & noexcept;
+        constexpr auto getTail() const& noexcept;
+        constexpr TailTuple getTail() && noexcept(std::is_nothrow_move_constructible_v<TailTuple>);
 
         template <std::size_t Index, typename TupleT, std::size_t Size>
         friend constexpr decltype(auto) get(TupleT&& tuple) noexcept;
+
+    private:
+        template <typename Self, std::size_t... Indices>
+        static constexpr auto viewOfTail(Self& self, std::index_sequence<Indices...>) noexcept;
+
+        template <std::size_t... Indices>
+        constexpr TailTuple moveTail(std::index_sequence<Indices...>);
     };
 } //namespace IDragnev
 
 #include "TupleImpl.hpp"
-#include "TupleUtilities.hpp"
\ No newline at end of file
+#include "TupleUtilities.hpp"
+#include "TupleView.hpp"
\ No newline at end of file
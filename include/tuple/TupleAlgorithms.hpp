@@ -34,6 +34,9 @@ namespace IDragnev
     template <>
     struct Meta::IsEmpty<Tuple<>> : std::true_type { };
 
+    template <typename Source>
+    struct Meta::IsEmpty<TupleView<Source>> : std::true_type { };
+
     template <typename... Elems, typename... Ts>
     struct Meta::InsertBackT<Tuple<Elems...>, Ts...>
     {
@@ -107,56 +110,141 @@ namespace IDragnev::TupleAlgorithms
 
     namespace Detail
     {
+        //selecting from a view gives a view, selecting from a tuple copies or moves the components
         template <typename TupleT, std::size_t... Indices>
         inline constexpr
         auto select(TupleT&& tuple, Meta::ValueList<std::size_t, Indices...>)
         {
-            return makeTuple(get<Indices>(std::forward<TupleT>(tuple))...);
+            if constexpr (IDragnev::Detail::isTupleView<TupleT>) {
+                return tuple.template select<Indices...>();
+            }
+            else {
+                return makeTuple(get<Indices>(std::forward<TupleT>(tuple))...);
+            }
         }
+
+        template <typename TupleT>
+        struct ElementsT
+        {
+            using type = std::decay_t<TupleT>;
+        };
+
+        template <typename Source, std::size_t... Indices>
+        struct ElementsT<TupleView<Source, Indices...>>
+        {
+            using type = typename TupleView<Source, Indices...>::Elements;
+        };
+
+        template <typename TupleT>
+        using Elements = typename ElementsT<std::decay_t<TupleT>>::type;
+
+        //the base of the structural algorithms, which compose with each other
+        struct IndexStage { };
+
+        template <typename F>
+        inline constexpr bool isIndexStage = std::is_base_of_v<IndexStage, std::decay_t<F>>;
     } //namespace Detail
 
+    struct AsView
+    {
+        template <typename... Types>
+        inline constexpr
+        auto operator()(Tuple<Types...>& tuple) const noexcept
+        {
+            return makeView(tuple, std::index_sequence_for<Types...>{});
+        }
+
+        template <typename... Types>
+        inline constexpr
+        auto operator()(const Tuple<Types...>& tuple) const noexcept
+        {
+            return makeView(tuple, std::index_sequence_for<Types...>{});
+        }
+
+        //a view of a temporary would dangle
+        template <typename... Types>
+        void operator()(const Tuple<Types...>&&) const = delete;
+
+    private:
+        template <typename TupleT, std::size_t... Indices>
+        static constexpr auto makeView(TupleT& tuple, std::index_sequence<Indices...>) noexcept
+        {
+            return TupleView<TupleT, Indices...>(tuple);
+        }
+    };
+
+    //views the components of a tuple without copying them
+    inline constexpr auto asView = AsView{};
+
+    struct Materialize
+    {
+        template <typename TupleT,
+                  typename = std::enable_if_t<isTuple<TupleT>>
+        > inline constexpr
+        auto operator()(TupleT&& t) const
+        {
+            if constexpr (IDragnev::Detail::isTupleView<TupleT>) {
+                return t.materialize();
+            }
+            else {
+                return std::decay_t<TupleT>(std::forward<TupleT>(t));
+            }
+        }
+    };
+
+    //copies the components of a view into a tuple
+    inline constexpr auto materialize = Materialize{};
+
+    //The structural algorithms only choose components by index.
+    //Each of them names the indices it chooses from a tuple of type TupleT as IndicesFor<TupleT>,
+    //so that piping them into each other folds a chain of them into a single selection (see Composed).
     template <std::size_t... Indices>
-    struct Select 
+    struct Select : Detail::IndexStage
     {
+        template <typename TupleT>
+        using IndicesFor = Meta::ValueList<std::size_t, Indices...>;
+
         template <typename TupleT,
                   typename = std::enable_if_t<isTuple<TupleT>>
         > inline constexpr
         auto operator()(TupleT&& tuple) const
         {
-            using IndicesT = Meta::ValueList<std::size_t, Indices...>;
-            return Detail::select(std::forward<TupleT>(tuple), IndicesT{});
+            return Detail::select(std::forward<TupleT>(tuple), IndicesFor<TupleT>{});
         }
     };
 
     template <std::size_t... Indices>
     inline constexpr auto select = Select<Indices...>{};
 
-    struct Reverse
+    struct Reverse : Detail::IndexStage
     {
+        template <typename TupleT>
+        using IndicesFor = Meta::Reverse<Meta::MakeIndexList<tupleSize<TupleT>>>;
+
         template <typename TupleT,
-                  std::size_t Size = tupleSize<TupleT>
+                  typename = std::enable_if_t<isTuple<TupleT>>
         > inline constexpr
         auto operator()(TupleT&& tuple) const
         {
-            using Meta::MakeIndexList;
-            using Indices = Meta::Reverse<MakeIndexList<Size>>;
-
-            return Detail::select(std::forward<TupleT>(tuple), Indices{});
+            return Detail::select(std::forward<TupleT>(tuple), IndicesFor<TupleT>{});
         }
     };
 
     inline constexpr auto reverse = Reverse{};
 
     template <std::size_t Index, std::size_t Count>
-    struct Replicate
+    struct Replicate : Detail::IndexStage
     {
-        template <typename Head,
-                  typename... Tail
+        template <typename TupleT>
+        using IndicesFor = Meta::ReplicateValue<Index, Count>;
+
+        template <typename TupleT,
+                  std::size_t Size = tupleSize<TupleT>,
+                  typename = std::enable_if_t<(Size > 0)>
         > inline constexpr
-        auto operator()(const Tuple<Head, Tail...>& t) const
+        auto operator()(const TupleT& t) const
         {
-            using Indices = Meta::ReplicateValue<Index, Count>;
-            return Detail::select(t, Indices{});
+            return Detail::select(t, IndicesFor<TupleT>{});
         }
     };
 
@@ -168,19 +256,21 @@ namespace IDragnev::TupleAlgorithms
     > inline constexpr 
     auto replicated(const T& value)
     {
-        return makeTuple(value) | replicate<0, Count>;
+        return replicate<0, Count>(makeTuple(value));
     }
 
     template <std::size_t N>
-    struct Take
+    struct Take : Detail::IndexStage
     {
+        template <typename TupleT>
+        using IndicesFor = Meta::MakeIndexList<N>;
+
         template <typename TupleT,
                   typename = std::enable_if_t<isTuple<TupleT>>
         > inline constexpr
         auto operator()(TupleT&& t) const
         {
-            using Indices = Meta::MakeIndexList<N>;
-            return Detail::select(std::forward<TupleT>(t), Indices{});
+            return Detail::select(std::forward<TupleT>(t), IndicesFor<TupleT>{});
         }
     };
 
@@ -190,17 +280,17 @@ namespace IDragnev::TupleAlgorithms
     inline constexpr auto dropTail = take<1>;
 
     template <std::size_t N>
-    struct Drop
+    struct Drop : Detail::IndexStage
     {
+        template <typename TupleT>
+        using IndicesFor = Meta::Drop<N, Meta::MakeIndexList<tupleSize<TupleT>>>;
+
         template <typename TupleT,
-                  std::size_t Size = tupleSize<TupleT>
+                  typename = std::enable_if_t<isTuple<TupleT>>
         > inline constexpr
         auto operator()(TupleT&& t) const
         {
-            using Meta::MakeIndexList;
-            using Indices = Meta::Drop<N, MakeIndexList<Size>>;
-
-            return Detail::select(std::forward<TupleT>(t), Indices{});
+            return Detail::select(std::forward<TupleT>(t), IndicesFor<TupleT>{});
         }
     };
 
@@ -210,27 +300,63 @@ namespace IDragnev::TupleAlgorithms
     inline constexpr auto dropHead = drop<1>;
 
     template <template <typename U, typename V> typename CompareFn>
-    struct SortByType
+    struct SortByType : Detail::IndexStage
     {
+        template <typename TupleT>
+        using IndicesFor = Meta::InsertionSort<Meta::MakeIndexList<tupleSize<TupleT>>,
+                                               Meta::MakeIndexedCompareT<Detail::Elements<TupleT>, CompareFn>::template invoke>;
+
         template <typename TupleT,
-                  std::size_t Size = tupleSize<TupleT>
+                  typename = std::enable_if_t<isTuple<TupleT>>
         > constexpr 
         auto operator()(TupleT&& t) const
         {
-            using Meta::InsertionSort;
-            using Meta::MakeIndexedCompareT;
-            using TypeList = std::decay_t<TupleT>;
-            using InitialIndices = Meta::MakeIndexList<Size>;
-            using SortedIndices = InsertionSort<InitialIndices,
-                                                MakeIndexedCompareT<TypeList, CompareFn>::template invoke>;
-
-            return Detail::select(std::forward<TupleT>(t), SortedIndices{});
+            return Detail::select(std::forward<TupleT>(t), IndicesFor<TupleT>{});
         }
     };
 
     template <template <typename U, typename V> typename CompareFn>
     inline constexpr auto sortByType = SortByType<CompareFn>{};
 
+    //Piping a structural algorithm into another one composes them into a single structural algorithm:
+    //t | (drop<2> | take<5> | reverse) copies only the five chosen components of t, once,
+    //while t | drop<2> | take<5> | reverse builds a tuple at every stage.
+    template <typename First, typename Second>
+    struct Composed : Detail::IndexStage
+    {
+    private:
+        template <typename Chosen, typename Positions>
+        struct IndicesForT;
+
+        template <typename Chosen, std::size_t... Positions>
+        struct IndicesForT<Chosen, Meta::ValueList<std::size_t, Positions...>>
+        {
+            using type = Meta::ValueList<std::size_t, Meta::ListRef<Chosen, Positions>::value...>;
+        };
+
+    public:
+        template <typename TupleT>
+        using IndicesFor = typename IndicesForT<typename First::template IndicesFor<TupleT>,
+                                                typename Second::template IndicesFor<std::invoke_result_t<First, TupleT>>>::type;
+
+        template <typename TupleT,
+                  typename = std::enable_if_t<isTuple<TupleT>>
+        > inline constexpr
+        auto operator()(TupleT&& t) const
+        {
+            return Detail::select(std::forward<TupleT>(t), IndicesFor<TupleT>{});
+        }
+    };
+
+    template <typename First,
+              typename Second,
+              typename = std::enable_if_t<Detail::isIndexStage<First> && Detail::isIndexStage<Second>>
+    > inline constexpr
+    auto operator|(First, Second) noexcept
+    {
+        return Composed<First, Second>{};
+    }
+
     namespace Detail
     {
         template <typename Callable, typename... Args>
@@ -281,54 +407,62 @@ namespace IDragnev::TupleAlgorithms
         return Detail::apply(f, std::forward<TupleT>(tuple), Indices{});
     }
 
-    template <typename TupleT,
-              typename T,
-              typename BinaryOp,
-              typename = std::enable_if_t<isTuple<TupleT> && 
-                                          Meta::isEmpty<std::decay_t<TupleT>>>
-    > inline constexpr
-    T foldl(TupleT&&, T&& acc, BinaryOp)
+    namespace Detail
     {
-        return std::forward<T>(acc);
-    }
+        template <std::size_t Index,
+                  typename TupleT,
+                  typename T,
+                  typename BinaryOp,
+                  std::size_t Size = tupleSize<TupleT>
+        > constexpr
+        decltype(auto) foldl(TupleT&& tuple, T&& acc, BinaryOp op)
+        {
+            if constexpr (Index == Size) {
+                return T(std::forward<T>(acc));
+            }
+            else {
+                return Detail::foldl<Index + 1>(std::forward<TupleT>(tuple),
+                                                op(std::forward<T>(acc), get<Index>(std::forward<TupleT>(tuple))),
+                                                op);
+            }
+        }
+
+        template <std::size_t Index,
+                  typename TupleT,
+                  typename T,
+                  typename BinaryOp,
+                  std::size_t Size = tupleSize<TupleT>
+        > constexpr
+        decltype(auto) foldr(TupleT&& tuple, T&& acc, BinaryOp op)
+        {
+            if constexpr (Index == Size) {
+                return T(std::forward<T>(acc));
+            }
+            else {
+                return op(get<Index>(std::forward<TupleT>(tuple)),
+                          Detail::foldr<Index + 1>(std::forward<TupleT>(tuple), std::forward<T>(acc), op));
+            }
+        }
+    } //namespace Detail
 
     template <typename TupleT,
               typename T,
               typename BinaryOp,
-              typename = std::enable_if_t<isTuple<TupleT> && 
-                                          !Meta::isEmpty<std::decay_t<TupleT>>>
-    > constexpr
-    decltype(auto) foldl(TupleT&& tuple, T&& acc, BinaryOp op)
-    {
-        return foldl(std::forward<TupleT>(tuple).getTail(),
-                     op(std::forward<T>(acc), std::forward<TupleT>(tuple).getHead()),
-                     op);
-    }
-    
-    template <typename TupleT,
-              typename T,
-              typename BinaryOp,
-              typename = std::enable_if_t<isTuple<TupleT> && 
-                                          Meta::isEmpty<std::decay_t<TupleT>>>
+              typename = std::enable_if_t<isTuple<TupleT>>
     > inline constexpr
-    T foldr(TupleT&&, T&& acc, BinaryOp)
+    decltype(auto) foldl(TupleT&& tuple, T&& acc, BinaryOp op)
     {
-        return std::forward<T>(acc);
+        return Detail::foldl<0>(std::forward<TupleT>(tuple), std::forward<T>(acc), op);
     }
 
     template <typename TupleT,
               typename T,
               typename BinaryOp,
-              typename = std::enable_if_t<isTuple<TupleT> && 
-                                          !Meta::isEmpty<std::decay_t<TupleT>>>
-    > constexpr
+              typename = std::enable_if_t<isTuple<TupleT>>
+    > inline constexpr
     decltype(auto) foldr(TupleT&& tuple, T&& acc, BinaryOp op)
     {
-        return op(std::forward<TupleT>(tuple).getHead(),
-                  foldr(std::forward<TupleT>(tuple).getTail(),
-                        std::forward<T>(acc),
-                        op)
-                 );
+        return Detail::foldr<0>(std::forward<TupleT>(tuple), std::forward<T>(acc), op);
     }
 
     namespace Detail 
@@ -355,45 +489,77 @@ namespace IDragnev::TupleAlgorithms
 
     namespace Detail
     {
-        template <typename UTuple,
-                  typename VTuple,
-                  std::size_t... UIndices,
-                  std::size_t... VIndices
-        > constexpr auto concatenate(UTuple&& u, VTuple&& v,
-                                     Meta::ValueList<std::size_t, UIndices...>,
-                                     Meta::ValueList<std::size_t, VIndices...>)
+        //the position of each element of a concatenation of tuples of the given sizes:
+        //the tuple it comes from and its index in that tuple
+        template <std::size_t Count>
+        struct ConcatenationPositions
+        {
+            std::size_t outer[Count + 1] = {};
+            std::size_t inner[Count + 1] = {};
+        };
+
+        template <std::size_t... Sizes>
+        constexpr auto concatenationPositions() noexcept
         {
-            return makeTuple(get<UIndices>(std::forward<UTuple>(u))...,
-                             get<VIndices>(std::forward<VTuple>(v))...);
+            constexpr std::size_t sizes[] = { Sizes..., 0 };
+            auto result = ConcatenationPositions<(Sizes + ... + 0)>{};
+            auto position = std::size_t{ 0 };
+
+            for (auto tuple = std::size_t{ 0 }; tuple < sizeof...(Sizes); ++tuple)
+            {
+                for (auto index = std::size_t{ 0 }; index < sizes[tuple]; ++index, ++position)
+                {
+                    result.outer[position] = tuple;
+                    result.inner[position] = index;
+                }
+            }
+
+            return result;
+        }
+
+        template <typename Sequence, std::size_t... Sizes>
+        struct ConcatenationIndicesT;
+
+        template <std::size_t... Is, std::size_t... Sizes>
+        struct ConcatenationIndicesT<std::index_sequence<Is...>, Sizes...>
+        {
+            static constexpr auto positions = concatenationPositions<Sizes...>();
+
+            using Outer = Meta::ValueList<std::size_t, positions.outer[Is]...>;
+            using Inner = Meta::ValueList<std::size_t, positions.inner[Is]...>;
+        };
+
+        template <std::size_t... Sizes>
+        using ConcatenationIndices = ConcatenationIndicesT<std::make_index_sequence<(Sizes + ... + 0)>, Sizes...>;
+
+        //tuples is a tuple of references to the concatenated tuples,
+        //each element is forwarded from its tuple straight into the result
+        template <typename TupleOfReferences,
+                  std::size_t... Outer,
+                  std::size_t... Inner
+        > constexpr auto concatenate(TupleOfReferences& tuples,
+                                     Meta::ValueList<std::size_t, Outer...>,
+                                     Meta::ValueList<std::size_t, Inner...>)
+        {
+            return makeTuple(get<Inner>(std::forward<Meta::ListRef<TupleOfReferences, Outer>>(get<Outer>(tuples)))...);
         }
 
         template <typename... Types>
         inline constexpr bool areAllTuples = Meta::Folds::allOf<IDragnev::Detail::IsTuple, std::decay_t<Types>...> ;
     } //namespace Detail
 
-    template <typename UTuple,
-              typename VTuple,
-              std::size_t USize = tupleSize<UTuple>,
-              std::size_t VSize = tupleSize<VTuple>
-    > constexpr auto concatenate(UTuple&& u, VTuple&& v)
-    {
-        using UIndices = Meta::MakeIndexList<USize>;
-        using VIndices = Meta::MakeIndexList<VSize>;
-
-        return Detail::concatenate(std::forward<UTuple>(u),
-                                   std::forward<VTuple>(v),
-                                   UIndices{},
-                                   VIndices{});
-    }
-
     template <typename UTuple,
               typename VTuple,
               typename... Tuples,
               typename = std::enable_if_t<Detail::areAllTuples<UTuple, VTuple, Tuples...>>
     > constexpr auto concatenate(UTuple&& u, VTuple&& v, Tuples&&... rest)
     {
-        return concatenate(concatenate(std::forward<UTuple>(u),
-                           std::forward<VTuple>(v)),
-                           std::forward<Tuples>(rest)...);
+        using Indices = Detail::ConcatenationIndices<tupleSize<UTuple>, tupleSize<VTuple>, tupleSize<Tuples>...>;
+
+        auto tuples = Tuple<UTuple&&, VTuple&&, Tuples&&...>(std::forward<UTuple>(u),
+                                                             std::forward<VTuple>(v),
+                                                             std::forward<Tuples>(rest)...);
+
+        return Detail::concatenate(tuples, typename Indices::Outer{}, typename Indices::Inner{});
     }
 } //namespace IDragnev::TupleAlgorithms
\ No newline at end of file
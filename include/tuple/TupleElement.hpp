@@ -3,71 +3,84 @@
 #include <type_traits>
 #include <utility>
 
+//the accessors of the components are inlined even in unoptimized builds,
+//where every call of get would otherwise go through three functions
+#if defined(__GNUC__) || defined(__clang__)
+    #define IDRAGNEV_ALWAYS_INLINE [[gnu::always_inline]] inline
+#elif defined(_MSC_VER)
+    #define IDRAGNEV_ALWAYS_INLINE __forceinline
+#else
+    #define IDRAGNEV_ALWAYS_INLINE inline
+#endif
+
 namespace IDragnev::Detail
 {
+    //only empty components are inherited, to take no space,
+    //a component inherited from a class with TupleElement bases of its own (such as a Tuple)
+    //would make the bases of its tuple ambiguous
     template <typename T>
-    inline constexpr auto canBeInherited = std::is_class_v<T> && !std::is_final_v<T>;
+    inline constexpr auto canBeInherited = std::is_empty_v<T> && !std::is_final_v<T>;
 
-    template <std::size_t Height,
+    template <std::size_t Index,
               typename T,
               bool = canBeInherited<T>
     > class TupleElement;
 
-    template <std::size_t Height, typename T>
-    class TupleElement<Height, T, false>
+    template <std::size_t Index, typename T>
+    class TupleElement<Index, T, false>
     {
     public:
         TupleElement() = default;
         template<typename U>
         constexpr TupleElement(U&& value) : value(std::forward<U>(value)) {}
 
-        constexpr T&& get() && noexcept { return std::move(value); }
-        constexpr const T&& get() const && noexcept { return std::move(value); }
-        constexpr T& get() & noexcept { return value; }
-        constexpr const T& get() const & noexcept { return value; }
+        IDRAGNEV_ALWAYS_INLINE constexpr T&& get() && noexcept { return std::move(value); }
+        IDRAGNEV_ALWAYS_INLINE constexpr const T&& get() const && noexcept { return std::move(value); }
+        IDRAGNEV_ALWAYS_INLINE constexpr T& get() & noexcept { return value; }
+        IDRAGNEV_ALWAYS_INLINE constexpr const T& get() const & noexcept { return value; }
 
     private:
         T value;
     };
 
-    template <std::size_t Height, typename T>
-    class TupleElement<Height, T, true> : private T
+    template <std::size_t Index, typename T>
+    class TupleElement<Index, T, true> : private T
     {
     public:
         TupleElement() = default;
         template<typename U>
         constexpr TupleElement(U&& value) : T(std::forward<U>(value)) {}
 
-        constexpr T&& get() && noexcept { return std::move(*this); }
-        constexpr const T&& get() const && noexcept { return std::move(*this); }
-        constexpr T& get() & noexcept { return *this; }
-        constexpr const T& get() const & noexcept { return *this; }
+        IDRAGNEV_ALWAYS_INLINE constexpr T&& get() && noexcept { return std::move(*this); }
+        IDRAGNEV_ALWAYS_INLINE constexpr const T&& get() const && noexcept { return std::move(*this); }
+        IDRAGNEV_ALWAYS_INLINE constexpr T& get() & noexcept { return *this; }
+        IDRAGNEV_ALWAYS_INLINE constexpr const T& get() const & noexcept { return *this; }
     };
 
-    template <std::size_t Height, typename T>
-    inline constexpr
-    const T& getValue(const TupleElement<Height, T>& e) noexcept
+    template <std::size_t Index, typename T>
+    IDRAGNEV_ALWAYS_INLINE constexpr
+    const T& getValue(const TupleElement<Index, T>& e) noexcept
     {
         return e.get();
     }
 
-    template <std::size_t Height, typename T>
-    inline constexpr
-    T& getValue(TupleElement<Height, T>& e) noexcept
+    template <std::size_t Index, typename T>
+    IDRAGNEV_ALWAYS_INLINE constexpr
+    T& getValue(TupleElement<Index, T>& e) noexcept
     {
         return const_cast<T&>(getValue(std::as_const(e)));
     }
 
-    template <std::size_t Height, typename T>
-    inline constexpr
-    const T&& getValue(const TupleElement<Height, T>&& e) noexcept
+    template <std::size_t Index, typename T>
+    IDRAGNEV_ALWAYS_INLINE constexpr
+    const T&& getValue(const TupleElement<Index, T>&& e) noexcept
     {
         return std::move(getValue(e));
     }
 
-    template <std::size_t Height, typename T>
-    inline constexpr
-    T&& getValue(TupleElement<Height, T>&& e) noexcept
+    template <std::size_t Index, typename T>
+    IDRAGNEV_ALWAYS_INLINE constexpr
+    T&& getValue(TupleElement<Index, T>&& e) noexcept
     {
         return std::move(e).get();
     }
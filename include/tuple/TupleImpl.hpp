@@ -1,27 +1,23 @@
-
 namespace IDragnev
 {
     template <typename Head, typename... Tail>
     template <typename VHead, typename... VTail, typename>
-    constexpr Tuple<Head, Tail...>::Tuple(VHead&& head, VTail&&... tail) 
-        : HeadElement(std::forward<VHead>(head)),
-        TailTuple(std::forward<VTail>(tail)...)
+    constexpr Tuple<Head, Tail...>::Tuple(VHead&& head, VTail&&... tail)
+        : Storage(Detail::FromComponents{}, std::forward<VHead>(head), std::forward<VTail>(tail)...)
     {
     }
 
     template <typename Head, typename... Tail>
     template <typename VHead, typename... VTail, typename>
-    constexpr Tuple<Head, Tail...>::Tuple(const Tuple<VHead, VTail...>& source) 
-        : HeadElement(source.getHead()),
-        TailTuple(source.getTail())
+    constexpr Tuple<Head, Tail...>::Tuple(const Tuple<VHead, VTail...>& source)
+        : Storage(Detail::FromTuple{}, source)
     {
     }
 
     template <typename Head, typename... Tail>
     template <typename VHead, typename... VTail, typename>
-    constexpr Tuple<Head, Tail...>::Tuple(Tuple<VHead, VTail...>&& source) 
-        : HeadElement(std::move(source.getHead())),
-        TailTuple(std::move(source.getTail()))
+    constexpr Tuple<Head, Tail...>::Tuple(Tuple<VHead, VTail...>&& source)
+        : Storage(Detail::FromTuple{}, std::move(source))
     {
     }
 
@@ -29,8 +25,7 @@ namespace IDragnev
     template <typename VHead, typename... VTail, typename>
     constexpr auto Tuple<Head, Tail...>::operator=(const Tuple<VHead, VTail...>& rhs) -> Tuple&
     {
-        getHead() = rhs.getHead();
-        getTail() = rhs.getTail();
+        Storage::assign(rhs);
 
         return *this;
     }
@@ -39,51 +34,66 @@ namespace IDragnev
     template <typename VHead, typename... VTail, typename>
     constexpr auto Tuple<Head, Tail...>::operator=(Tuple<VHead, VTail...>&& rhs) -> Tuple&
     {
-        getHead() = std::move(rhs.getHead());
-        getTail() = std::move(rhs.getTail());
+        Storage::assign(std::move(rhs));
 
         return *this;
     }
 
     template <typename Head, typename... Tail>
-    inline constexpr
+    IDRAGNEV_ALWAYS_INLINE constexpr
     Head&& Tuple<Head, Tail...>::getHead() && noexcept
     {
-        return std::move(getHead());
+        return IDragnev::get<0>(std::move(*this));
     }
 
     template <typename Head, typename... Tail>
-    inline constexpr
+    IDRAGNEV_ALWAYS_INLINE constexpr
     Head& Tuple<Head, Tail...>::getHead() & noexcept
     {
-        return const_cast<Head&>(std::as_const(*this).getHead());
+        return IDragnev::get<0>(*this);
     }
 
     template <typename Head, typename... Tail>
-    inline constexpr
+    IDRAGNEV_ALWAYS_INLINE constexpr
     const Head& Tuple<Head, Tail...>::getHead() const& noexcept
     {
-        return static_cast<const HeadElement&>(*this).get();
+        return IDragnev::get<0>(*this);
     }
 
     template <typename Head, typename... Tail>
+    template <typename Self, std::size_t... Indices>
     inline constexpr
-    auto Tuple<Head, Tail...>::getTail() && noexcept -> TailTuple&&
+    auto Tuple<Head, Tail...>::viewOfTail(Self& self, std::index_sequence<Indices...>) noexcept
     {
-        return std::move(getTail());
+        return TupleView<Self, (Indices + 1)...>(self);
     }
 
     template <typename Head, typename... Tail>
+    template <std::size_t... Indices>
     inline constexpr
-    auto Tuple<Head, Tail...>::getTail() & noexcept -> TailTuple&
+    auto Tuple<Head, Tail...>::moveTail(std::index_sequence<Indices...>) -> TailTuple
     {
-        return const_cast<TailTuple&>(std::as_const(*this).getTail());
+        return TailTuple(IDragnev::get<Indices + 1>(std::move(*this))...);
     }
 
     template <typename Head, typename... Tail>
     inline constexpr
-    auto Tuple<Head, Tail...>::getTail() const& noexcept -> const TailTuple&
+    auto Tuple<Head, Tail...>::getTail() && noexcept(std::is_nothrow_move_constructible_v<TailTuple>) -> TailTuple
     {
-        return *this;
+        return moveTail(std::index_sequence_for<Tail...>{});
+    }
+
+    template <typename Head, typename... Tail>
+    inline constexpr
+    auto Tuple<Head, Tail...>::getTail() & noexcept
+    {
+        return viewOfTail(*this, std::index_sequence_for<Tail...>{});
+    }
+
+    template <typename Head, typename... Tail>
+    inline constexpr
+    auto Tuple<Head, Tail...>::getTail() const& noexcept
+    {
+        return viewOfTail(*this, std::index_sequence_for<Tail...>{});
     }
 } //namespace IDragnev
\ No newline at end of file
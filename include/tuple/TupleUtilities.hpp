@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 namespace IDragnev
 {
     namespace Detail
@@ -17,21 +19,23 @@ namespace IDragnev
         template <typename U, typename V>
         using EnableIfHaveSameLength = std::enable_if_t<haveSameLength<U, V>>;
 
-        template <typename CompareFn>
-        inline constexpr
-        bool compareWith(CompareFn&&, const Tuple<>&, const Tuple<>&) noexcept
+        template <typename CompareFn,
+                  typename UTuple,
+                  typename VTuple,
+                  std::size_t... Indices
+        > inline constexpr
+        bool compareWith([[maybe_unused]] CompareFn compare, const UTuple& u, const VTuple& v, std::index_sequence<Indices...>)
         {
-            return true;
+            return (compare(get<Indices>(u), get<Indices>(v)) && ...);
         }
 
         template <typename CompareFn,
-                  typename UHead, typename... UTail,
-                  typename VHead, typename... VTail
-        > constexpr bool
-        compareWith(CompareFn compare, const Tuple<UHead, UTail...>& u, const Tuple<VHead, VTail...>& v)
+                  typename... Us,
+                  typename... Vs
+        > inline constexpr
+        bool compareWith(CompareFn compare, const Tuple<Us...>& u, const Tuple<Vs...>& v)
         {
-            return compare(u.getHead(), v.getHead()) &&
-                   compareWith(compare, u.getTail(), v.getTail());
+            return compareWith(compare, u, v, std::index_sequence_for<Us...>{});
         }
     } //namespace Detail
 
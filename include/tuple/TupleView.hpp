@@ -0,0 +1,206 @@
+#pragma once
+
+#include "meta/ListAlgorithms.hpp"
+#include <utility>
+
+namespace IDragnev
+{
+    namespace Detail
+    {
+        template <typename Source, std::size_t... Indices>
+        struct TupleSize<TupleView<Source, Indices...>> : Meta::CTValue<std::size_t, sizeof...(Indices)> { };
+
+        template <typename U, typename V, bool = isTuple<U> && isTuple<V>>
+        struct HaveSameSize : std::false_type { };
+
+        template <typename U, typename V>
+        struct HaveSameSize<U, V, true> : std::bool_constant<tupleSize<U> == tupleSize<V>> { };
+
+        //the comparisons of Tuple cover two tuples, these cover a view and any tuple of its size
+        template <typename U, typename V>
+        using EnableIfComparableWithView = std::enable_if_t<(isTupleView<U> || isTupleView<V>) && HaveSameSize<U, V>::value>;
+    } //namespace Detail
+
+    //A tuple of references to the components of Source at Indices.
+    //Selecting from a view gives another view of the same source, so algorithms such as
+    //take, drop, reverse and select compose without copying any component.
+    //A view does not own its source and must not outlive it, materialize() copies the components.
+    //Like a tuple of references, a view assigns and compares the components it refers to.
+    template <typename Source, std::size_t... Indices>
+    class TupleView
+    {
+    private:
+        using IndexList = Meta::ValueList<std::size_t, Indices...>;
+
+        template <std::size_t Index>
+        static constexpr std::size_t sourceIndex = Meta::ListRef<IndexList, Index>::value;
+
+        template <typename TupleT>
+        static constexpr bool hasSizeOf = Detail::HaveSameSize<TupleView, TupleT>::value;
+
+    public:
+        using Elements = Meta::TypeList<std::decay_t<decltype(IDragnev::get<Indices>(std::declval<Source&>()))>...>;
+
+        constexpr explicit TupleView(Source& source) noexcept;
+        TupleView(const TupleView& source) = default;
+
+        constexpr const TupleView& operator=(const TupleView& rhs) const;
+
+        template <typename TupleT,
+                  typename = std::enable_if_t<hasSizeOf<TupleT>>
+        > constexpr const TupleView& operator=(TupleT&& rhs) const;
+
+        template <std::size_t Index>
+        constexpr decltype(auto) get() const noexcept;
+
+        //the view of the components of this view at Positions
+        template <std::size_t... Positions>
+        constexpr auto select() const noexcept;
+
+        constexpr decltype(auto) getHead() const noexcept;
+        constexpr auto getTail() const noexcept;
+
+        constexpr auto materialize() const;
+
+    private:
+        template <std::size_t... Positions>
+        constexpr auto selectShifted(std::index_sequence<Positions...>) const noexcept;
+
+        template <typename TupleT, std::size_t... Positions>
+        constexpr void assign(TupleT&& rhs, std::index_sequence<Positions...>) const;
+
+    private:
+        Source* source;
+    };
+
+    template <typename Source, std::size_t... Indices>
+    constexpr TupleView<Source, Indices...>::TupleView(Source& source) noexcept :
+        source(&source)
+    {
+    }
+
+    template <typename Source, std::size_t... Indices>
+    inline constexpr
+    auto TupleView<Source, Indices...>::operator=(const TupleView& rhs) const -> const TupleView&
+    {
+        assign(rhs, std::make_index_sequence<sizeof...(Indices)>{});
+        return *this;
+    }
+
+    template <typename Source, std::size_t... Indices>
+    template <typename TupleT, typename>
+    inline constexpr
+    auto TupleView<Source, Indices...>::operator=(TupleT&& rhs) const -> const TupleView&
+    {
+        assign(std::forward<TupleT>(rhs), std::make_index_sequence<sizeof...(Indices)>{});
+        return *this;
+    }
+
+    template <typename Source, std::size_t... Indices>
+    template <typename TupleT, std::size_t... Positions>
+    inline constexpr
+    void TupleView<Source, Indices...>::assign(TupleT&& rhs, std::index_sequence<Positions...>) const
+    {
+        ((get<Positions>() = IDragnev::get<Positions>(std::forward<TupleT>(rhs))), ...);
+    }
+
+    template <typename Source, std::size_t... Indices>
+    template <std::size_t Index>
+    inline constexpr
+    decltype(auto) TupleView<Source, Indices...>::get() const noexcept
+    {
+        return IDragnev::get<sourceIndex<Index>>(*source);
+    }
+
+    template <typename Source, std::size_t... Indices>
+    template <std::size_t... Positions>
+    inline constexpr
+    auto TupleView<Source, Indices...>::select() const noexcept
+    {
+        return TupleView<Source, sourceIndex<Positions>...>(*source);
+    }
+
+    template <typename Source, std::size_t... Indices>
+    inline constexpr
+    decltype(auto) TupleView<Source, Indices...>::getHead() const noexcept
+    {
+        return get<0>();
+    }
+
+    template <typename Source, std::size_t... Indices>
+    inline constexpr
+    auto TupleView<Source, Indices...>::getTail() const noexcept
+    {
+        static_assert(sizeof...(Indices) > 0, "an empty view has no tail");
+        return selectShifted(std::make_index_sequence<sizeof...(Indices) - 1>{});
+    }
+
+    template <typename Source, std::size_t... Indices>
+    template <std::size_t... Positions>
+    inline constexpr
+    auto TupleView<Source, Indices...>::selectShifted(std::index_sequence<Positions...>) const noexcept
+    {
+        return select<(Positions + 1)...>();
+    }
+
+    template <typename Source, std::size_t... Indices>
+    inline constexpr
+    auto TupleView<Source, Indices...>::materialize() const
+    {
+        return makeTuple(IDragnev::get<Indices>(*source)...);
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator==(const UTuple& u, const VTuple& v)
+    {
+        return Detail::compareWith(std::equal_to{}, u, v, std::make_index_sequence<tupleSize<UTuple>>{});
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator!=(const UTuple& u, const VTuple& v)
+    {
+        return !(u == v);
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator<(const UTuple& u, const VTuple& v)
+    {
+        return Detail::compareWith(std::less{}, u, v, std::make_index_sequence<tupleSize<UTuple>>{});
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator>(const UTuple& u, const VTuple& v)
+    {
+        return v < u;
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator>=(const UTuple& u, const VTuple& v)
+    {
+        return Detail::compareWith(std::greater_equal{}, u, v, std::make_index_sequence<tupleSize<UTuple>>{});
+    }
+
+    template <typename UTuple,
+              typename VTuple,
+              typename = Detail::EnableIfComparableWithView<UTuple, VTuple>
+    > inline constexpr
+    bool operator<=(const UTuple& u, const VTuple& v)
+    {
+        return Detail::compareWith(std::less_equal{}, u, v, std::make_index_sequence<tupleSize<UTuple>>{});
+    }
+} //namespace IDragnev
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "Variant.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace IDragnev
+{
+    namespace Detail
+    {
+        template <std::size_t Size>
+        struct alignas(Size) PaddedBytes
+        {
+            unsigned char bytes[Size];
+        };
+
+        //the bytes of V padded to a power of two, the size std::atomic can make lock-free
+        template <typename V>
+        using PaddedFor = PaddedBytes<roundUpToPowerOfTwo(sizeof(V))>;
+
+        //V is trivially copyable, so copying the bytes of a V into another V gives it the same value
+        template <typename V, typename Bytes>
+        inline V fromBytes(const Bytes& bytes) noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<V> && sizeof(V) <= sizeof(Bytes));
+
+            auto result = V{};
+            std::memcpy(static_cast<void*>(&result), &bytes, sizeof(V));
+            return result;
+        }
+
+        template <typename V>
+        class LockFreeCell
+        {
+        public:
+            static constexpr bool isLockFree = true;
+
+            explicit LockFreeCell(const V& value) noexcept : bytes(toBytes(value)) { }
+
+            V load() const noexcept;
+            void store(const V& value) noexcept { bytes.store(toBytes(value), std::memory_order_release); }
+
+        private:
+            using Bytes = PaddedFor<V>;
+
+            static Bytes toBytes(const V& value) noexcept;
+
+        private:
+            std::atomic<Bytes> bytes;
+        };
+
+        template <typename V>
+        inline auto LockFreeCell<V>::toBytes(const V& value) noexcept -> Bytes
+        {
+            auto result = Bytes{};
+            std::memcpy(&result, &value, sizeof(V));
+            return result;
+        }
+
+        template <typename V>
+        inline V LockFreeCell<V>::load() const noexcept
+        {
+            return fromBytes<V>(bytes.load(std::memory_order_acquire));
+        }
+
+        //A seqlock: the writer makes the sequence odd, copies the bytes of the variant
+        //and makes it even again. Readers copy the bytes and retry if the sequence
+        //was odd or changed in the meantime, so they never block the writer.
+        //The bytes are kept in relaxed atomic words, which makes the racing copies well defined.
+        template <typename V>
+        class SeqLockCell
+        {
+        private:
+            using Word = std::uintptr_t;
+
+            static constexpr std::size_t wordsCount = (sizeof(V) + sizeof(Word) - 1) / sizeof(Word);
+            static constexpr std::size_t alignment = std::max(alignof(V), alignof(Word));
+            static constexpr unsigned spinsBeforeYield = 64;
+
+            struct alignas(alignment) Words
+            {
+                Word words[wordsCount];
+            };
+
+        public:
+            static constexpr bool isLockFree = false;
+
+            explicit SeqLockCell(const V& value) noexcept;
+
+            V load() const noexcept;
+            void store(const V& value) noexcept;
+
+        private:
+            std::atomic<std::uint64_t> sequence{ 0 };
+            std::atomic<Word> words[wordsCount];
+        };
+
+        template <typename V>
+        SeqLockCell<V>::SeqLockCell(const V& value) noexcept
+        {
+            auto source = Words{};
+            std::memcpy(&source, &value, sizeof(V));
+
+            for (auto i = std::size_t{ 0 }; i < wordsCount; ++i)
+            {
+                words[i].store(source.words[i], std::memory_order_relaxed);
+            }
+        }
+
+        template <typename V>
+        void SeqLockCell<V>::store(const V& value) noexcept
+        {
+            auto source = Words{};
+            std::memcpy(&source, &value, sizeof(V));
+
+            //writers exclude each other by moving the sequence from even to odd
+            auto current = sequence.load(std::memory_order_relaxed);
+            do
+            {
+                current &= ~std::uint64_t{ 1 };
+            } while (!sequence.compare_exchange_weak(current, current + 1, std::memory_order_relaxed));
+
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (auto i = std::size_t{ 0 }; i < wordsCount; ++i)
+            {
+                words[i].store(source.words[i], std::memory_order_relaxed);
+            }
+
+            sequence.store(current + 2, std::memory_order_release);
+        }
+
+        template <typename V>
+        V SeqLockCell<V>::load() const noexcept
+        {
+            auto result = Words{};
+
+            for (auto attempts = 0u;; ++attempts)
+            {
+                //a writer preempted in the middle of a store is waited for without burning its time slice
+                if (attempts >= spinsBeforeYield)
+                {
+                    std::this_thread::yield();
+                }
+
+                const auto before = sequence.load(std::memory_order_acquire);
+
+                for (auto i = std::size_t{ 0 }; i < wordsCount; ++i)
+                {
+                    result.words[i] = words[i].load(std::memory_order_relaxed);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if ((before & 1) == 0 && sequence.load(std::memory_order_relaxed) == before)
+                {
+                    break;
+                }
+            }
+
+            return fromBytes<V>(result);
+        }
+
+        template <typename V>
+        constexpr bool fitsLockFreeAtomic() noexcept
+        {
+            if constexpr (sizeof(V) <= 16)
+            {
+                return std::atomic<PaddedFor<V>>::is_always_lock_free;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        template <typename V>
+        using AtomicCell = std::conditional_t<fitsLockFreeAtomic<V>(), LockFreeCell<V>, SeqLockCell<V>>;
+    }
+
+    //A Variant of trivially copyable types which can be stored and loaded concurrently.
+    //It is a std::atomic when one is lock-free for the size of the variant rounded up
+    //to a power of two (up to 8 bytes, or 16 where the target has a double-width CAS)
+    //and a seqlock otherwise.
+    //Loads always return a value which was stored as a whole.
+    template <typename... Types>
+    class AtomicVariant
+    {
+    private:
+        static_assert((std::is_trivially_copyable_v<Types> && ...),
+                      "AtomicVariant holds trivially copyable types only");
+
+        template <typename T>
+        using EnableIfAlternative = std::enable_if_t<Meta::isMember<std::decay_t<T>, Meta::TypeList<Types...>>>;
+
+    public:
+        using Value = Variant<Types...>;
+
+        static constexpr bool isLockFree = Detail::AtomicCell<Value>::isLockFree;
+
+        AtomicVariant() noexcept(std::is_nothrow_default_constructible_v<Value>);
+        explicit AtomicVariant(const Value& value) noexcept;
+        AtomicVariant(const AtomicVariant&) = delete;
+        ~AtomicVariant() = default;
+
+        AtomicVariant& operator=(const AtomicVariant&) = delete;
+
+        Value load() const noexcept;
+        void store(const Value& value) noexcept;
+
+        template <typename T, typename = EnableIfAlternative<T>>
+        void store(const T& value) noexcept;
+
+    private:
+        Detail::AtomicCell<Value> cell;
+    };
+
+    template <typename... Types>
+    inline AtomicVariant<Types...>::AtomicVariant() noexcept(std::is_nothrow_default_constructible_v<Value>) :
+        cell(Value{})
+    {
+    }
+
+    template <typename... Types>
+    inline AtomicVariant<Types...>::AtomicVariant(const Value& value) noexcept :
+        cell(value)
+    {
+    }
+
+    template <typename... Types>
+    inline auto AtomicVariant<Types...>::load() const noexcept -> Value
+    {
+        return cell.load();
+    }
+
+    template <typename... Types>
+    inline void AtomicVariant<Types...>::store(const Value& value) noexcept
+    {
+        cell.store(value);
+    }
+
+    template <typename... Types>
+    template <typename T, typename>
+    inline void AtomicVariant<Types...>::store(const T& value) noexcept
+    {
+        cell.store(Value(value));
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace IDragnev
+{
+    class BoxArena;
+
+    //A handle to a T allocated in a BoxArena.
+    //It lets a variant hold a type which contains the variant itself:
+    //    struct Add;
+    //    using Expr = Variant<double, Box<Add>>;
+    //    struct Add { Expr lhs; Expr rhs; };
+    //visit passes the boxed T to the visitor instead of the box.
+    //Copies of a box refer to the same T, which lives as long as its arena.
+    template <typename T>
+    class Box
+    {
+    public:
+        T& operator*() const noexcept { return *pointer; }
+        T* operator->() const noexcept { return pointer; }
+        T* get() const noexcept { return pointer; }
+
+    private:
+        friend class BoxArena;
+
+        explicit Box(T* pointer) noexcept : pointer(pointer) { }
+
+    private:
+        T* pointer;
+    };
+
+    //Allocates boxed values by bumping a pointer through large blocks
+    //and releases all of them at once when destroyed
+    class BoxArena
+    {
+    public:
+        explicit BoxArena(std::size_t initialBlockSize = 64 * 1024);
+        BoxArena(const BoxArena&) = delete;
+        BoxArena(BoxArena&&) = delete;
+        ~BoxArena();
+
+        BoxArena& operator=(const BoxArena&) = delete;
+        BoxArena& operator=(BoxArena&&) = delete;
+
+        template <typename T, typename... Args>
+        Box<T> make(Args&&... args);
+
+    private:
+        struct Finalizer
+        {
+            void (*destroy)(void*);
+            void* object;
+        };
+
+        template <typename T>
+        static void destroy(void* object) noexcept;
+
+    private:
+        std::pmr::monotonic_buffer_resource resource;
+        std::vector<Finalizer> finalizers;
+    };
+
+    inline BoxArena::BoxArena(std::size_t initialBlockSize) :
+        resource(initialBlockSize)
+    {
+    }
+
+    inline BoxArena::~BoxArena()
+    {
+        for (auto i = finalizers.rbegin(); i != finalizers.rend(); ++i)
+        {
+            i->destroy(i->object);
+        }
+    }
+
+    template <typename T>
+    void BoxArena::destroy(void* object) noexcept
+    {
+        static_cast<T*>(object)->~T();
+    }
+
+    template <typename T, typename... Args>
+    Box<T> BoxArena::make(Args&&... args)
+    {
+        //trivially destructible values are released with the blocks, without a finalizer
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            finalizers.reserve(finalizers.size() + 1);
+        }
+
+        auto memory = resource.allocate(sizeof(T), alignof(T));
+        auto object = new(memory) T(std::forward<Args>(args)...);
+
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            finalizers.push_back({ &destroy<T>, object });
+        }
+
+        return Box<T>(object);
+    }
+
+    namespace Detail
+    {
+        template <typename T>
+        struct IsBox : std::false_type { };
+
+        template <typename T>
+        struct IsBox<Box<T>> : std::true_type { };
+
+        //the reference a visitor receives for an alternative of type Reference:
+        //a box is replaced by a reference to its value, which keeps the constness of the box
+        template <typename Reference, bool = IsBox<std::decay_t<Reference>>::value>
+        struct UnboxedT
+        {
+            using type = Reference;
+        };
+
+        template <typename Reference>
+        struct UnboxedT<Reference, true>
+        {
+            using Boxed = std::remove_reference_t<decltype(*std::declval<std::decay_t<Reference>&>())>;
+            using type = std::conditional_t<std::is_const_v<std::remove_reference_t<Reference>>, const Boxed&, Boxed&>;
+        };
+
+        template <typename Reference>
+        using Unboxed = typename UnboxedT<Reference>::type;
+
+        template <typename Reference>
+        inline Unboxed<Reference&&> unbox(Reference&& value) noexcept
+        {
+            if constexpr (IsBox<std::decay_t<Reference>>::value)
+            {
+                return *value;
+            }
+            else
+            {
+                return std::forward<Reference>(value);
+            }
+        }
+    }
+}
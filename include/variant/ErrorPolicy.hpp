@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cassert>
+#include <cstdlib>
+#include <utility>
+
+//IDRAGNEV_ERROR_POLICY selects what the library does on an error,
+//such as accessing or visiting an empty variant:
+//  IDRAGNEV_ERROR_POLICY_THROW - throws the error (the default when exceptions are enabled)
+//  IDRAGNEV_ERROR_POLICY_ABORT - calls std::abort (the default with -fno-exceptions)
+//  IDRAGNEV_ERROR_POLICY_UNREACHABLE - assumes errors never happen, which lets the
+//      compiler drop the checks; debug builds still abort
+//The policy must be the same in every translation unit of a program.
+
+#define IDRAGNEV_ERROR_POLICY_THROW 1
+#define IDRAGNEV_ERROR_POLICY_ABORT 2
+#define IDRAGNEV_ERROR_POLICY_UNREACHABLE 3
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define IDRAGNEV_HAS_EXCEPTIONS 1
+#else
+    #define IDRAGNEV_HAS_EXCEPTIONS 0
+#endif
+
+#ifndef IDRAGNEV_ERROR_POLICY
+    #if IDRAGNEV_HAS_EXCEPTIONS
+        #define IDRAGNEV_ERROR_POLICY IDRAGNEV_ERROR_POLICY_THROW
+    #else
+        #define IDRAGNEV_ERROR_POLICY IDRAGNEV_ERROR_POLICY_ABORT
+    #endif
+#endif
+
+#if IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_THROW && !IDRAGNEV_HAS_EXCEPTIONS
+    #error "IDRAGNEV_ERROR_POLICY_THROW needs exceptions to be enabled"
+#endif
+
+//exception-neutral cleanup: without exceptions the handler is never entered
+#if IDRAGNEV_HAS_EXCEPTIONS
+    #define IDRAGNEV_TRY try
+    #define IDRAGNEV_CATCH_ALL catch (...)
+    #define IDRAGNEV_RETHROW throw
+#else
+    #define IDRAGNEV_TRY if (true)
+    #define IDRAGNEV_CATCH_ALL else
+    #define IDRAGNEV_RETHROW ((void)0)
+#endif
+
+namespace IDragnev::Detail
+{
+    template <typename Error>
+    [[noreturn]] inline void fail(Error&& error)
+    {
+#if IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_THROW
+        throw std::forward<Error>(error);
+#elif IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_ABORT
+        (void)error;
+        std::abort();
+#elif IDRAGNEV_ERROR_POLICY == IDRAGNEV_ERROR_POLICY_UNREACHABLE
+        (void)error;
+    #ifndef NDEBUG
+        std::abort();
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        __assume(false);
+    #else
+        __builtin_unreachable();
+    #endif
+#else
+    #error "unknown IDRAGNEV_ERROR_POLICY"
+#endif
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace IDragnev
+{
+    //Describes bit patterns of T which never represent a valid value of T (a niche).
+    //A specialization provides:
+    //  offset - the position of the niche in the object representation of T
+    //  count  - the number of invalid patterns
+    //  load(niche)         - the index of the invalid pattern at niche, or count if it holds a valid T
+    //  store(niche, index) - writes the invalid pattern with the given index at niche
+    //where niche points offset bytes past the start of the object.
+    //A Variant stores its discriminator in the niche of one of its alternatives
+    //instead of in a separate field when every other alternative fits before the niche.
+    template <typename T>
+    struct NicheTraits
+    {
+        static constexpr std::size_t offset = 0;
+        static constexpr std::size_t count = 0;
+    };
+
+    //a byte at Offset whose only valid values are [0, ValidValues)
+    template <std::size_t Offset, unsigned char ValidValues>
+    struct ByteNiche
+    {
+        static constexpr std::size_t offset = Offset;
+        static constexpr std::size_t count = 256 - ValidValues;
+
+        static std::size_t load(const void* niche) noexcept
+        {
+            const auto byte = *static_cast<const unsigned char*>(niche);
+            return (byte < ValidValues) ? count : byte - ValidValues;
+        }
+
+        static void store(void* niche, std::size_t index) noexcept
+        {
+            *static_cast<unsigned char*>(niche) = static_cast<unsigned char>(ValidValues + index);
+        }
+    };
+
+    //a pointer which is either null or aligned to Alignment,
+    //the misaligned values in [1, Alignment) are used as the invalid patterns
+    template <typename Pointer, std::size_t Alignment>
+    struct PointerNiche
+    {
+        static_assert(std::is_pointer_v<Pointer>, "PointerNiche describes pointers only");
+        static_assert(Alignment > 1 && (Alignment & (Alignment - 1)) == 0,
+                      "Alignment must be a power of two greater than one");
+        static_assert(sizeof(Pointer) == sizeof(std::uintptr_t));
+
+        static constexpr std::size_t offset = 0;
+        static constexpr std::size_t count = Alignment - 1;
+
+        static std::size_t load(const void* niche) noexcept
+        {
+            auto bits = std::uintptr_t{ 0 };
+            std::memcpy(&bits, niche, sizeof(Pointer));
+            return (bits != 0 && bits < Alignment) ? bits - 1 : count;
+        }
+
+        static void store(void* niche, std::size_t index) noexcept
+        {
+            const auto bits = static_cast<std::uintptr_t>(index + 1);
+            std::memcpy(niche, &bits, sizeof(Pointer));
+        }
+    };
+
+    template <>
+    struct NicheTraits<bool> : ByteNiche<0, 2> { };
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "ErrorPolicy.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace IDragnev
+{
+    //Storage policies of BasicVariant.
+    //A policy provides spills<T>, which tells whether the alternative T
+    //is held in a separately allocated slot instead of in the variant itself.
+    //A policy may also provide a State, kept by each variant next to its value.
+
+    struct InlineStorage
+    {
+        template <typename T>
+        static constexpr bool spills = false;
+    };
+
+    //alternatives larger than Threshold bytes are allocated through Allocator
+    template <std::size_t Threshold, typename Allocator = std::allocator<std::byte>>
+    struct SpillAbove
+    {
+        using SlotAllocator = Allocator;
+
+        template <typename T>
+        static constexpr bool spills = sizeof(T) > Threshold;
+    };
+
+    //Each variant holds a memory resource and constructs the alternatives
+    //which use allocators with it (uses-allocator construction).
+    //The resource is passed on to copies and moves of the variant
+    //and kept by the variant when it is assigned to.
+    struct PmrStorage
+    {
+        template <typename T>
+        static constexpr bool spills = false;
+
+        class State
+        {
+        public:
+            using Allocator = std::pmr::polymorphic_allocator<std::byte>;
+
+            State() noexcept = default;
+            explicit State(const Allocator& allocator) noexcept : resource(allocator.resource()) { }
+            State(const State& source) noexcept = default;
+            ~State() = default;
+
+            State& operator=(const State&) noexcept { return *this; }
+
+            void adopt(const State& source) noexcept { resource = source.resource; }
+            Allocator getAllocator() const noexcept { return resource; }
+
+        private:
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+        };
+    };
+}
+
+namespace IDragnev::Detail
+{
+    //owns a T allocated through a stateless Allocator
+    template <typename T, typename Allocator>
+    class SpilledValue
+    {
+    private:
+        using AllocatorTraits = typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+        using TAllocator = typename AllocatorTraits::allocator_type;
+
+    public:
+        template <typename... Args>
+        explicit SpilledValue(std::in_place_t, Args&&... args);
+        SpilledValue(const SpilledValue& source);
+        SpilledValue(SpilledValue&& source) noexcept;
+        ~SpilledValue();
+
+        SpilledValue& operator=(const SpilledValue& rhs);
+        SpilledValue& operator=(SpilledValue&& rhs) noexcept;
+
+        T* get() noexcept { return value; }
+        const T* get() const noexcept { return value; }
+
+    private:
+        T* value = nullptr;
+    };
+
+    template <typename T, typename Allocator>
+    template <typename... Args>
+    SpilledValue<T, Allocator>::SpilledValue(std::in_place_t, Args&&... args)
+    {
+        auto allocator = TAllocator{};
+        const auto slot = AllocatorTraits::allocate(allocator, 1);
+
+        IDRAGNEV_TRY
+        {
+            AllocatorTraits::construct(allocator, std::addressof(*slot), std::forward<Args>(args)...);
+        }
+        IDRAGNEV_CATCH_ALL
+        {
+            AllocatorTraits::deallocate(allocator, slot, 1);
+            IDRAGNEV_RETHROW;
+        }
+
+        value = std::addressof(*slot);
+    }
+
+    template <typename T, typename Allocator>
+    inline SpilledValue<T, Allocator>::SpilledValue(const SpilledValue& source) :
+        SpilledValue(std::in_place, *source.value)
+    {
+    }
+
+    template <typename T, typename Allocator>
+    inline SpilledValue<T, Allocator>::SpilledValue(SpilledValue&& source) noexcept :
+        value(std::exchange(source.value, nullptr))
+    {
+    }
+
+    template <typename T, typename Allocator>
+    SpilledValue<T, Allocator>::~SpilledValue()
+    {
+        if (value != nullptr)
+        {
+            auto allocator = TAllocator{};
+            AllocatorTraits::destroy(allocator, value);
+            AllocatorTraits::deallocate(allocator, value, 1);
+        }
+    }
+
+    template <typename T, typename Allocator>
+    inline auto SpilledValue<T, Allocator>::operator=(const SpilledValue& rhs) -> SpilledValue&
+    {
+        //the slot is reused, T is assigned in place
+        *value = *rhs.value;
+        return *this;
+    }
+
+    template <typename T, typename Allocator>
+    inline auto SpilledValue<T, Allocator>::operator=(SpilledValue&& rhs) noexcept -> SpilledValue&
+    {
+        std::swap(value, rhs.value);
+        return *this;
+    }
+
+    template <typename Policy, typename T, bool = Policy::template spills<T>>
+    struct StoredAlternativeT
+    {
+        using type = T;
+    };
+
+    template <typename Policy, typename T>
+    struct StoredAlternativeT<Policy, T, true>
+    {
+        using type = SpilledValue<T, typename Policy::SlotAllocator>;
+    };
+
+    template <typename Policy, typename T>
+    using StoredAlternative = typename StoredAlternativeT<Policy, T>::type;
+
+    struct NoPolicyState
+    {
+        void adopt(const NoPolicyState&) noexcept { }
+    };
+
+    template <typename Policy, typename = std::void_t<>>
+    struct PolicyStateT
+    {
+        using type = NoPolicyState;
+    };
+
+    template <typename Policy>
+    struct PolicyStateT<Policy, std::void_t<typename Policy::State>>
+    {
+        using type = typename Policy::State;
+    };
+
+    template <typename Policy>
+    using PolicyState = typename PolicyStateT<Policy>::type;
+
+    //provides allocator_type when the state of Policy has an Allocator,
+    //which makes the variant itself allocator-aware
+    template <typename Policy, typename = std::void_t<>>
+    struct PolicyAllocatorType { };
+
+    template <typename Policy>
+    struct PolicyAllocatorType<Policy, std::void_t<typename PolicyState<Policy>::Allocator>>
+    {
+        using allocator_type = typename PolicyState<Policy>::Allocator;
+    };
+
+    template <typename T, typename Policy, typename = std::void_t<>>
+    struct UsesPolicyAllocator : std::false_type { };
+
+    template <typename T, typename Policy>
+    struct UsesPolicyAllocator<T, Policy, std::void_t<typename PolicyState<Policy>::Allocator>> :
+        std::uses_allocator<T, typename PolicyState<Policy>::Allocator>
+    { };
+
+    template <typename T, typename Policy>
+    inline constexpr bool usesPolicyAllocator = UsesPolicyAllocator<T, Policy>::value;
+
+    template <typename Policy, typename Allocator, typename = std::void_t<>>
+    struct AcceptsAllocator : std::false_type { };
+
+    template <typename Policy, typename Allocator>
+    struct AcceptsAllocator<Policy, Allocator, std::void_t<typename PolicyState<Policy>::Allocator>> :
+        std::is_convertible<const Allocator&, typename PolicyState<Policy>::Allocator>
+    { };
+
+    template <typename Policy, typename Allocator>
+    inline constexpr bool acceptsAllocator = AcceptsAllocator<Policy, Allocator>::value;
+}
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "VariantChoice.hpp"
-#include "VariantStorage.hpp"
+#include "VariantBase.hpp"
 #include "meta/ListAlgorithms.hpp"
 #include "VisitResult.hpp"
+#include "VariantDispatch.hpp"
+#include "StoragePolicy.hpp"
+#include "Box.hpp"
+#include "ErrorPolicy.hpp"
 
 #include <stdexcept>
 
@@ -11,42 +15,157 @@ namespace IDragnev
 {
     class EmptyVariant : public std::exception { };
 
+    template <typename Policy, typename... Types>
+    class BasicVariant;
+
     template <typename... Types>
-    class Variant
-        : private Detail::VariantStorage<Types...>,
-          private Detail::VariantChoice<Types, Types...>...
+    using Variant = BasicVariant<InlineStorage, Types...>;
+
+    namespace pmr
+    {
+        template <typename... Types>
+        using Variant = BasicVariant<PmrStorage, Types...>;
+    }
+
+    template <typename T>
+    struct InPlaceType
+    {
+        explicit InPlaceType() = default;
+    };
+
+    template <typename T>
+    inline constexpr InPlaceType<T> inPlaceType{};
+
+    template <std::size_t I>
+    struct InPlaceIndex
+    {
+        explicit InPlaceIndex() = default;
+    };
+
+    template <std::size_t I>
+    inline constexpr InPlaceIndex<I> inPlaceIndex{};
+
+    namespace Detail
+    {
+        template <typename V>
+        struct VariantAlternativesT { };
+
+        template <typename Policy, typename... Types>
+        struct VariantAlternativesT<BasicVariant<Policy, Types...>>
+        {
+            using type = Meta::TypeList<Types...>;
+        };
+
+        template <typename V>
+        using VariantAlternatives = typename VariantAlternativesT<std::decay_t<V>>::type;
+
+        template <typename V>
+        using WithEmptyAlternative = Meta::InsertFront<VariantAlternatives<V>, NoValue>;
+
+        template <typename V, typename = std::void_t<>>
+        struct IsVariant : std::false_type { };
+
+        template <typename V>
+        struct IsVariant<V, std::void_t<typename VariantAlternativesT<std::decay_t<V>>::type>> : std::true_type { };
+
+        template <typename V>
+        inline constexpr bool isVariant = IsVariant<V>::value;
+
+        template <typename V, typename T>
+        using ForwardLike = std::conditional_t<std::is_lvalue_reference_v<V>,
+                                               std::conditional_t<std::is_const_v<std::remove_reference_t<V>>, const T&, T&>,
+                                               std::conditional_t<std::is_const_v<std::remove_reference_t<V>>, const T&&, T&&>>;
+
+        template <typename V, typename List = VariantAlternatives<V>>
+        struct QualifiedAlternativesT;
+
+        template <typename V, typename... Types>
+        struct QualifiedAlternativesT<V, Meta::TypeList<Types...>>
+        {
+            using type = Meta::TypeList<Unboxed<ForwardLike<V, Types>>...>;
+        };
+
+        template <typename V>
+        using QualifiedAlternatives = typename QualifiedAlternativesT<V>::type;
+    }
+
+    //Policy decides where each alternative is stored, see StoragePolicy.hpp
+    template <typename Policy, typename... Types>
+    class BasicVariant
+        : public Detail::PolicyAllocatorType<Policy>,
+          private Detail::VariantBase<Policy, Types...>,
+          private Detail::VariantChoice<Types, Policy, Types...>...
     {
     private:
-        template <typename T, typename... AllTypes>
+        template <typename T, typename P, typename... AllTypes>
         friend class Detail::VariantChoice;
+        friend struct Detail::VariantAccess;
 
         template <typename T>
-        using VChoice = Detail::VariantChoice<T, Types...>;
+        using VChoice = Detail::VariantChoice<T, Policy, Types...>;
+
+        template <std::size_t I>
+        using TypeAt = Meta::ListRef<Meta::TypeList<Types...>, I>;
+
+        using State = Detail::PolicyState<Policy>;
+
+        template <typename Allocator>
+        using EnableIfAllocator = std::enable_if_t<Detail::acceptsAllocator<Policy, Allocator>>;
+
+        template <typename T>
+        using EnableIfAlternative = std::enable_if_t<Meta::isMember<std::decay_t<T>, Meta::TypeList<Types...>>>;
 
     public:
         using VChoice<Types>::VariantChoice...;
 
-        Variant();                                         
-        Variant(Variant&& source);                
-        Variant(const Variant& source);                    
-        ~Variant();
+        BasicVariant();                                         
+        BasicVariant(BasicVariant&& source) = default;
+        BasicVariant(const BasicVariant& source) = default;
+        ~BasicVariant() = default;
         
-        template <typename... SourceTypes>
-        Variant(Variant<SourceTypes...>&& source);
+        template <typename SourcePolicy, typename... SourceTypes>
+        BasicVariant(BasicVariant<SourcePolicy, SourceTypes...>&& source);
+
+        template <typename SourcePolicy, typename... SourceTypes>
+        BasicVariant(const BasicVariant<SourcePolicy, SourceTypes...>& source);
 
-        template <typename... SourceTypes>
-        Variant(const Variant<SourceTypes...>& source);
+        template <typename T, typename... Args>
+        explicit BasicVariant(InPlaceType<T>, Args&&... args);
+
+        template <std::size_t I, typename... Args>
+        explicit BasicVariant(InPlaceIndex<I>, Args&&... args);
+
+        template <typename Allocator, typename = EnableIfAllocator<Allocator>>
+        BasicVariant(std::allocator_arg_t, const Allocator& allocator);
+
+        template <typename Allocator, typename = EnableIfAllocator<Allocator>>
+        BasicVariant(std::allocator_arg_t, const Allocator& allocator, const BasicVariant& source);
+
+        template <typename Allocator, typename = EnableIfAllocator<Allocator>>
+        BasicVariant(std::allocator_arg_t, const Allocator& allocator, BasicVariant&& source);
+
+        template <typename Allocator, typename T, typename = EnableIfAllocator<Allocator>, typename = EnableIfAlternative<T>>
+        BasicVariant(std::allocator_arg_t, const Allocator& allocator, T&& value);
+
+        template <typename Allocator, typename T, typename... Args, typename = EnableIfAllocator<Allocator>>
+        BasicVariant(std::allocator_arg_t, const Allocator& allocator, InPlaceType<T>, Args&&... args);
         
         using VChoice<Types>::operator=...;
 
-        Variant& operator=(Variant&& source);
-        Variant& operator=(const Variant& source);
+        BasicVariant& operator=(BasicVariant&& source) = default;
+        BasicVariant& operator=(const BasicVariant& source) = default;
+
+        template <typename SourcePolicy, typename... SourceTypes>
+        BasicVariant& operator=(BasicVariant<SourcePolicy, SourceTypes...>&& source);
+
+        template <typename SourcePolicy, typename... SourceTypes>
+        BasicVariant& operator=(const BasicVariant<SourcePolicy, SourceTypes...>& source);
 
-        template <typename... SourceTypes>
-        Variant& operator=(Variant<SourceTypes...>&& source);
+        template <typename T, typename... Args>
+        T& emplace(Args&&... args);
 
-        template <typename... SourceTypes>
-        Variant& operator=(const Variant<SourceTypes...>& source);
+        template <std::size_t I, typename... Args>
+        TypeAt<I>& emplace(Args&&... args);
 
         template <typename T>
         bool is() const noexcept;          
@@ -60,37 +179,85 @@ namespace IDragnev
         template <typename T> 
         const T& get() const&;      
 
+        template <std::size_t I>
+        TypeAt<I>& get() &;
+
+        template <std::size_t I>
+        TypeAt<I>&& get() &&;
+
+        template <std::size_t I>
+        const TypeAt<I>& get() const&;
+
+        //nullptr unless the variant holds a T
+        template <typename T>
+        T* getIf() noexcept;
+
+        template <typename T>
+        const T* getIf() const noexcept;
+
+        //no checks beyond an assert, the variant must hold a T
+        template <typename T>
+        T& getUnchecked() & noexcept;
+
+        template <typename T>
+        T&& getUnchecked() && noexcept;
+
+        template <typename T>
+        const T& getUnchecked() const& noexcept;
+
+        //the discriminator: 0 when the variant is empty, indexOf<T> when it holds a T
+        std::size_t index() const noexcept;
+
+        template <typename T>
+        static constexpr std::size_t indexOf = Meta::indexOf<T, Meta::TypeList<Types...>> + 1;
+
         bool isEmpty() const noexcept;
+
+        template <typename S = State>
+        typename S::Allocator getAllocator() const noexcept;
  
     private:
-        static constexpr unsigned char NO_VALUE_DISCRIMINATOR = 0;
-        
+        using Base = Detail::VariantBase<Policy, Types...>;
+        using Base::NO_VALUE_DISCRIMINATOR;
+
         template <typename VariantT>
         void copyFromIfNotEmpty(VariantT&& source);
         template <typename VariantT>
         void copyFrom(VariantT&& source);
         template <typename VariantT>
-        Variant& assignFrom(VariantT&& source);
-        void destroyValue() noexcept;
+        BasicVariant& assignFrom(VariantT&& source);
     };
 
     template <typename R = Detail::DeduceResultType,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, Types&...> 
-    visit(Variant<Types...>& variant, Visitor&& v);
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&>...> 
+    visit(BasicVariant<Policy, Types...>& variant, Visitor&& v);
         
     template <typename R = Detail::DeduceResultType,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, const Types&...>
-    visit(const Variant<Types...>& variant, Visitor&& v);
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<const Types&>...>
+    visit(const BasicVariant<Policy, Types...>& variant, Visitor&& v);
         
     template <typename R = Detail::DeduceResultType,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, Types&&...>
-    visit(Variant<Types...>&& variant, Visitor&& v);
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&&>...>
+    visit(BasicVariant<Policy, Types...>&& variant, Visitor&& v);
+
+    template <typename R = Detail::DeduceResultType,
+              typename Visitor,
+              typename V,
+              typename... Variants,
+              typename = std::enable_if_t<!Detail::isVariant<Visitor> &&
+                                          Detail::isVariant<V> &&
+                                          (Detail::isVariant<Variants> && ...)>
+    > Detail::CartesianVisitResult<R, Visitor, Detail::QualifiedAlternatives<V>, Detail::QualifiedAlternatives<Variants>...>
+    visit(Visitor&& v, V&& variant, Variants&&... rest);
 }
 
 #include "VariantImpl.hpp"
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "VariantStorage.hpp"
+#include "meta/Folds.hpp"
+#include <type_traits>
+
+namespace IDragnev::Detail
+{
+    //Each layer below defines one special member of the variant storage.
+    //A layer leaves its member defaulted when every stored alternative has it trivial,
+    //so Variant<Types...> is trivially copyable whenever all of Types are.
+
+    template <typename... Types>
+    inline constexpr bool areTriviallyDestructible = Meta::Folds::allOf<std::is_trivially_destructible, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areTriviallyCopyConstructible = Meta::Folds::allOf<std::is_trivially_copy_constructible, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areTriviallyMoveConstructible = Meta::Folds::allOf<std::is_trivially_move_constructible, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areTriviallyCopyAssignable = areTriviallyDestructible<Types...> &&
+                                                       areTriviallyCopyConstructible<Types...> &&
+                                                       Meta::Folds::allOf<std::is_trivially_copy_assignable, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areTriviallyMoveAssignable = areTriviallyDestructible<Types...> &&
+                                                       areTriviallyMoveConstructible<Types...> &&
+                                                       Meta::Folds::allOf<std::is_trivially_move_assignable, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areNothrowMoveConstructible = Meta::Folds::allOf<std::is_nothrow_move_constructible, Types...>;
+
+    template <typename... Types>
+    inline constexpr bool areNothrowMoveAssignable = areNothrowMoveConstructible<Types...> &&
+                                                     Meta::Folds::allOf<std::is_nothrow_move_assignable, Types...>;
+
+    template <bool isTrivial, typename Policy, typename... Types>
+    class VariantDestructor : public VariantStorage<Policy, Types...> { };
+
+    template <typename Policy, typename... Types>
+    class VariantDestructor<false, Policy, Types...> : public VariantStorage<Policy, Types...>
+    {
+    public:
+        VariantDestructor() = default;
+        VariantDestructor(const VariantDestructor&) = default;
+        VariantDestructor(VariantDestructor&&) = default;
+        ~VariantDestructor() { this->destroyValue(); }
+
+        VariantDestructor& operator=(const VariantDestructor&) = default;
+        VariantDestructor& operator=(VariantDestructor&&) = default;
+    };
+
+    template <typename Policy, typename... Types>
+    using VariantDestructorFor = VariantDestructor<areTriviallyDestructible<StoredAlternative<Policy, Types>...>, Policy, Types...>;
+
+    template <bool isTrivial, typename Policy, typename... Types>
+    class VariantCopyConstructor : public VariantDestructorFor<Policy, Types...> { };
+
+    template <typename Policy, typename... Types>
+    class VariantCopyConstructor<false, Policy, Types...> : public VariantDestructorFor<Policy, Types...>
+    {
+    public:
+        VariantCopyConstructor() = default;
+        VariantCopyConstructor(const VariantCopyConstructor& source) { this->constructFrom(source); }
+        VariantCopyConstructor(VariantCopyConstructor&&) = default;
+        ~VariantCopyConstructor() = default;
+
+        VariantCopyConstructor& operator=(const VariantCopyConstructor&) = default;
+        VariantCopyConstructor& operator=(VariantCopyConstructor&&) = default;
+    };
+
+    template <typename Policy, typename... Types>
+    using VariantCopyConstructorFor = VariantCopyConstructor<areTriviallyCopyConstructible<StoredAlternative<Policy, Types>...>, Policy, Types...>;
+
+    template <bool isTrivial, typename Policy, typename... Types>
+    class VariantMoveConstructor : public VariantCopyConstructorFor<Policy, Types...> { };
+
+    template <typename Policy, typename... Types>
+    class VariantMoveConstructor<false, Policy, Types...> : public VariantCopyConstructorFor<Policy, Types...>
+    {
+    public:
+        VariantMoveConstructor() = default;
+        VariantMoveConstructor(const VariantMoveConstructor&) = default;
+        VariantMoveConstructor(VariantMoveConstructor&& source) noexcept(areNothrowMoveConstructible<StoredAlternative<Policy, Types>...>)
+        {
+            this->constructFrom(std::move(source));
+        }
+        ~VariantMoveConstructor() = default;
+
+        VariantMoveConstructor& operator=(const VariantMoveConstructor&) = default;
+        VariantMoveConstructor& operator=(VariantMoveConstructor&&) = default;
+    };
+
+    template <typename Policy, typename... Types>
+    using VariantMoveConstructorFor = VariantMoveConstructor<areTriviallyMoveConstructible<StoredAlternative<Policy, Types>...>, Policy, Types...>;
+
+    template <bool isTrivial, typename Policy, typename... Types>
+    class VariantCopyAssignment : public VariantMoveConstructorFor<Policy, Types...> { };
+
+    template <typename Policy, typename... Types>
+    class VariantCopyAssignment<false, Policy, Types...> : public VariantMoveConstructorFor<Policy, Types...>
+    {
+    public:
+        VariantCopyAssignment() = default;
+        VariantCopyAssignment(const VariantCopyAssignment&) = default;
+        VariantCopyAssignment(VariantCopyAssignment&&) = default;
+        ~VariantCopyAssignment() = default;
+
+        VariantCopyAssignment& operator=(const VariantCopyAssignment& source)
+        {
+            this->assignFrom(source);
+            return *this;
+        }
+
+        VariantCopyAssignment& operator=(VariantCopyAssignment&&) = default;
+    };
+
+    template <typename Policy, typename... Types>
+    using VariantCopyAssignmentFor = VariantCopyAssignment<areTriviallyCopyAssignable<StoredAlternative<Policy, Types>...>, Policy, Types...>;
+
+    template <bool isTrivial, typename Policy, typename... Types>
+    class VariantMoveAssignment : public VariantCopyAssignmentFor<Policy, Types...> { };
+
+    template <typename Policy, typename... Types>
+    class VariantMoveAssignment<false, Policy, Types...> : public VariantCopyAssignmentFor<Policy, Types...>
+    {
+    public:
+        VariantMoveAssignment() = default;
+        VariantMoveAssignment(const VariantMoveAssignment&) = default;
+        VariantMoveAssignment(VariantMoveAssignment&&) = default;
+        ~VariantMoveAssignment() = default;
+
+        VariantMoveAssignment& operator=(const VariantMoveAssignment&) = default;
+
+        VariantMoveAssignment& operator=(VariantMoveAssignment&& source) noexcept(areNothrowMoveAssignable<StoredAlternative<Policy, Types>...>)
+        {
+            this->assignFrom(std::move(source));
+            return *this;
+        }
+    };
+
+    template <typename Policy, typename... Types>
+    using VariantBase = VariantMoveAssignment<areTriviallyMoveAssignable<StoredAlternative<Policy, Types>...>, Policy, Types...>;
+}
@@ -1,29 +1,28 @@
 #pragma once
 
 #include "meta/ListAlgorithms.hpp"
+#include "VariantStorage.hpp"
 #include <utility>
 
 namespace IDragnev
 {
-    template <typename... Types>
-    class Variant;
+    template <typename Policy, typename... Types>
+    class BasicVariant;
 }
 
 namespace IDragnev::Detail
 {
-    template <typename T, typename... AllTypes>
+    template <typename T, typename Policy, typename... AllTypes>
     class VariantChoice
     {
     private:
-        using Derived = Variant<AllTypes...>;
+        using Derived = BasicVariant<Policy, AllTypes...>;
 
     public:
         VariantChoice() = default;
         VariantChoice(T&& value);              
         VariantChoice(const T& value);         
         
-        void destroyValueIfHoldingIt() noexcept;
-        
         Derived& operator=(T&& value);
         Derived& operator=(const T& value);  
 
@@ -32,9 +31,10 @@ namespace IDragnev::Detail
 
         bool isTheCurrentVariantChoice() const noexcept;
 
+        template <typename... Args>
+        void emplace(Args&&... args);
+
     private:
-        template <typename Value>
-        void emplace(Value&& value);
         template <typename Value>
         Derived& assign(Value&& value);
 
@@ -1,53 +1,51 @@
-
 namespace IDragnev::Detail
 {
-    template<typename T, typename... AllTypes>
-    inline VariantChoice<T, AllTypes...>::VariantChoice(T&& value)
+    template <typename T, typename Policy, typename... AllTypes>
+    inline VariantChoice<T, Policy, AllTypes...>::VariantChoice(T&& value)
     {
         emplace(std::move(value));
     }
 
-    template<typename T, typename... AllTypes>
-    inline VariantChoice<T, AllTypes...>::VariantChoice(const T& value)
+    template <typename T, typename Policy, typename... AllTypes>
+    inline VariantChoice<T, Policy, AllTypes...>::VariantChoice(const T& value)
     {
         emplace(value);
     }
 
-    template <typename T, typename... AllTypes>
-    template <typename Value>
-    void VariantChoice<T, AllTypes...>::emplace(Value&& value)
+    template <typename T, typename Policy, typename... AllTypes>
+    template <typename... Args>
+    void VariantChoice<T, Policy, AllTypes...>::emplace(Args&&... args)
     {
-        new(asDerived().getRawBuffer()) T(std::forward<Value>(value));
-        asDerived().setDiscriminator(discriminator);
+        asDerived().template construct<T>(std::forward<Args>(args)...);
     }
 
-    template <typename T, typename... AllTypes>
-    inline auto VariantChoice<T, AllTypes...>::asDerived() noexcept -> Derived&
+    template <typename T, typename Policy, typename... AllTypes>
+    inline auto VariantChoice<T, Policy, AllTypes...>::asDerived() noexcept -> Derived&
     {
         return static_cast<Derived&>(*this);
     }
 
-    template <typename T, typename... AllTypes>
-    inline auto VariantChoice<T, AllTypes...>::asDerived() const noexcept ->  const Derived&
+    template <typename T, typename Policy, typename... AllTypes>
+    inline auto VariantChoice<T, Policy, AllTypes...>::asDerived() const noexcept ->  const Derived&
     {
         return static_cast<const Derived&>(*this);
     }
 
-    template<typename T, typename... AllTypes>
-    inline auto VariantChoice<T, AllTypes...>::operator=(T&& value) -> Derived&
+    template <typename T, typename Policy, typename... AllTypes>
+    inline auto VariantChoice<T, Policy, AllTypes...>::operator=(T&& value) -> Derived&
     {
         return assign(std::move(value));
     }
 
-    template <typename T, typename... AllTypes>
-    inline auto VariantChoice<T, AllTypes...>::operator=(const T& value) -> Derived&
+    template <typename T, typename Policy, typename... AllTypes>
+    inline auto VariantChoice<T, Policy, AllTypes...>::operator=(const T& value) -> Derived&
     {
         return assign(value);
     }
 
-    template <typename T, typename... AllTypes>
+    template <typename T, typename Policy, typename... AllTypes>
     template <typename Value>
-    auto VariantChoice<T, AllTypes...>::assign(Value&& value) -> Derived&
+    auto VariantChoice<T, Policy, AllTypes...>::assign(Value&& value) -> Derived&
     {
         if (isTheCurrentVariantChoice())
         {
@@ -62,18 +60,9 @@ namespace IDragnev::Detail
         return asDerived();
     }
 
-    template <typename T, typename... AllTypes>
-    bool VariantChoice<T, AllTypes...>::isTheCurrentVariantChoice() const noexcept
+    template <typename T, typename Policy, typename... AllTypes>
+    bool VariantChoice<T, Policy, AllTypes...>::isTheCurrentVariantChoice() const noexcept
     {
         return asDerived().getDiscriminator() == discriminator;
     }
-
-    template <typename T, typename... AllTypes>
-    void VariantChoice<T, AllTypes...>::destroyValueIfHoldingIt() noexcept
-    {
-        if (isTheCurrentVariantChoice())
-        {
-            asDerived().template getBufferAs<T>()->~T();
-        }
-    }
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "meta/TypeList.hpp"
+#include "meta/ListAlgorithms.hpp"
+#include "meta/TypeFunctionsAndPredicates.hpp"
+#include <cstddef>
+#include <utility>
+
+namespace IDragnev::Detail
+{
+    //stands for the alternative of an empty variant (discriminator 0)
+    struct NoValue { };
+
+    template <typename List>
+    struct DispatchDimension;
+
+    template <typename... Types>
+    struct DispatchDimension<Meta::TypeList<Types...>> : std::integral_constant<std::size_t, sizeof...(Types)> { };
+
+    template <typename R,
+              typename F,
+              typename Lists,
+              typename FlatIndices
+    > class DispatchTable;
+
+    //a row-major table over the cartesian product of Lists,
+    //the entry at a flat index calls f with one Meta::IdentityT per list
+    template <typename R,
+              typename F,
+              typename... Lists,
+              std::size_t... FlatIndices
+    > class DispatchTable<R, F, Meta::TypeList<Lists...>, std::index_sequence<FlatIndices...>>
+    {
+    private:
+        using Entry = R(*)(F&&);
+
+        static constexpr std::size_t sizes[] = { DispatchDimension<Lists>::value... };
+
+        static constexpr std::size_t strideOf(std::size_t dimension) noexcept
+        {
+            auto result = std::size_t{ 1 };
+
+            for (auto i = dimension + 1; i < sizeof...(Lists); ++i)
+            {
+                result *= sizes[i];
+            }
+
+            return result;
+        }
+
+        template <std::size_t Flat, std::size_t Dimension>
+        static constexpr std::size_t positionAt = (Flat / strideOf(Dimension)) % sizes[Dimension];
+
+        template <std::size_t Flat, std::size_t... Dimensions>
+        static R invoke(F&& f, std::index_sequence<Dimensions...>)
+        {
+            return std::forward<F>(f)(Meta::IdentityT<Meta::ListRef<Lists, positionAt<Flat, Dimensions>>>{}...);
+        }
+
+        template <std::size_t Flat>
+        static R invokeAt(F&& f)
+        {
+            return invoke<Flat>(std::forward<F>(f), std::index_sequence_for<Lists...>{});
+        }
+
+    public:
+        static constexpr Entry entries[] = { &invokeAt<FlatIndices>... };
+
+        template <typename... Positions>
+        static std::size_t flatten(Positions... positions) noexcept
+        {
+            auto result = std::size_t{ 0 };
+            auto dimension = std::size_t{ 0 };
+            ((result = result * sizes[dimension++] + positions), ...);
+
+            return result;
+        }
+    };
+
+    //a single list needs no positions unpacked, its entries are expanded straight from the pack
+    template <typename R,
+              typename F,
+              typename... Types,
+              std::size_t... FlatIndices
+    > class DispatchTable<R, F, Meta::TypeList<Meta::TypeList<Types...>>, std::index_sequence<FlatIndices...>>
+    {
+    private:
+        using Entry = R(*)(F&&);
+
+        template <typename T>
+        static R invoke(F&& f)
+        {
+            return std::forward<F>(f)(Meta::IdentityT<T>{});
+        }
+
+    public:
+        static constexpr Entry entries[] = { &invoke<Types>... };
+
+        static std::size_t flatten(std::size_t position) noexcept
+        {
+            return position;
+        }
+    };
+
+    //calls f with Meta::IdentityT<T>... where each T is taken from the corresponding list
+    //at the corresponding position, jumping through a single table instead of comparing
+    //the positions against each element of the lists
+    template <typename R,
+              typename... Lists,
+              typename F,
+              typename... Positions
+    > inline R dispatch(F&& f, Positions... positions)
+    {
+        static_assert(sizeof...(Lists) == sizeof...(Positions), "one position is needed per list");
+
+        constexpr auto size = (DispatchDimension<Lists>::value * ...);
+        using Table = DispatchTable<R, F, Meta::TypeList<Lists...>, std::make_index_sequence<size>>;
+
+        return Table::entries[Table::flatten(static_cast<std::size_t>(positions)...)](std::forward<F>(f));
+    }
+}
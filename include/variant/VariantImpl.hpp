@@ -3,108 +3,158 @@
 
 namespace IDragnev
 {
-    template <typename... Types>
-    Variant<Types...>::Variant()
+    template <typename Policy, typename... Types>
+    BasicVariant<Policy, Types...>::BasicVariant() :
+        BasicVariant(inPlaceIndex<0>)
     {
-        using T = Meta::Head<Meta::TypeList<Types...>>;
-        *this = T{};
     }
 
-    template <typename... Types>
-    Variant<Types...>::Variant(Variant&& source)
+    template <typename Policy, typename... Types>
+    template <typename T, typename... Args>
+    BasicVariant<Policy, Types...>::BasicVariant(InPlaceType<T>, Args&&... args)
     {
-        copyFromIfNotEmpty(std::move(source));
+        static_assert(Meta::isMember<T, Meta::TypeList<Types...>>, "T is not an alternative of the variant");
+        VChoice<T>::emplace(std::forward<Args>(args)...);
     }
 
-    template <typename... Types>
-    template <typename... SourceTypes>
-    Variant<Types...>::Variant(Variant<SourceTypes...>&& source)
+    template <typename Policy, typename... Types>
+    template <std::size_t I, typename... Args>
+    inline BasicVariant<Policy, Types...>::BasicVariant(InPlaceIndex<I>, Args&&... args) :
+        BasicVariant(inPlaceType<TypeAt<I>>, std::forward<Args>(args)...)
     {
-        copyFromIfNotEmpty(std::move(source));
     }
 
-    template <typename... Types>
-    Variant<Types...>::Variant(const Variant& source)
+    template <typename Policy, typename... Types>
+    template <typename Allocator, typename>
+    inline BasicVariant<Policy, Types...>::BasicVariant(std::allocator_arg_t, const Allocator& allocator) :
+        BasicVariant(std::allocator_arg, allocator, inPlaceType<TypeAt<0>>)
     {
-        copyFromIfNotEmpty(source);
     }
 
-    template <typename... Types>
-    template <typename... SourceTypes>
-    Variant<Types...>::Variant(const Variant<SourceTypes...>& source)
+    template <typename Policy, typename... Types>
+    template <typename Allocator, typename>
+    BasicVariant<Policy, Types...>::BasicVariant(std::allocator_arg_t, const Allocator& allocator, const BasicVariant& source)
     {
-        copyFromIfNotEmpty(source);
+        this->adopt(State(allocator));
+        this->constructValueFrom(static_cast<const Base&>(source));
     }
 
-    template <typename... Types>
-    template <typename VariantT>
-    inline void Variant<Types...>::copyFromIfNotEmpty(VariantT&& source)
+    template <typename Policy, typename... Types>
+    template <typename Allocator, typename>
+    BasicVariant<Policy, Types...>::BasicVariant(std::allocator_arg_t, const Allocator& allocator, BasicVariant&& source)
     {
-        if (!source.isEmpty())
-        {
-            copyFrom(std::forward<VariantT>(source));
-        }
+        this->adopt(State(allocator));
+        this->constructValueFrom(static_cast<Base&&>(source));
     }
 
-    template <typename... Types>
-    template <typename VariantT>
-    void Variant<Types...>::copyFrom(VariantT&& source)
+    template <typename Policy, typename... Types>
+    template <typename Allocator, typename T, typename, typename>
+    inline BasicVariant<Policy, Types...>::BasicVariant(std::allocator_arg_t, const Allocator& allocator, T&& value) :
+        BasicVariant(std::allocator_arg, allocator, inPlaceType<std::decay_t<T>>, std::forward<T>(value))
     {
-        assert(!source.isEmpty());
-        visit(std::forward<VariantT>(source), [this](auto&& value)
-        {
-            *this = std::forward<decltype(value)>(value);
-        });
     }
 
-    template<typename... Types>
-    inline bool Variant<Types...>::isEmpty() const noexcept
+    template <typename Policy, typename... Types>
+    template <typename Allocator, typename T, typename... Args, typename>
+    BasicVariant<Policy, Types...>::BasicVariant(std::allocator_arg_t, const Allocator& allocator, InPlaceType<T>, Args&&... args)
     {
-        return this->getDiscriminator() == NO_VALUE_DISCRIMINATOR;
+        static_assert(Meta::isMember<T, Meta::TypeList<Types...>>, "T is not an alternative of the variant");
+
+        this->adopt(State(allocator));
+        VChoice<T>::emplace(std::forward<Args>(args)...);
     }
 
-    template <typename... Types>
-    Variant<Types...>::~Variant()
+    template <typename Policy, typename... Types>
+    template <typename S>
+    inline auto BasicVariant<Policy, Types...>::getAllocator() const noexcept -> typename S::Allocator
     {
-        destroyValue();
+        return State::getAllocator();
     }
 
-    template<typename... Types>
-    void Variant<Types...>::destroyValue() noexcept
+    template <typename Policy, typename... Types>
+    template <typename T, typename... Args>
+    T& BasicVariant<Policy, Types...>::emplace(Args&&... args)
     {
-        (VChoice<Types>::destroyValueIfHoldingIt(), ...);
-        this->setDiscriminator(NO_VALUE_DISCRIMINATOR);
+        static_assert(Meta::isMember<T, Meta::TypeList<Types...>>, "T is not an alternative of the variant");
+
+        this->destroyValue();
+        VChoice<T>::emplace(std::forward<Args>(args)...);
+
+        return *(this->template getBufferAs<T>());
     }
 
-    template <typename... Types>
-    inline auto Variant<Types...>::operator=(Variant&& source) -> Variant&
+    template <typename Policy, typename... Types>
+    template <std::size_t I, typename... Args>
+    inline auto BasicVariant<Policy, Types...>::emplace(Args&&... args) -> TypeAt<I>&
     {
-        return assignFrom(std::move(source));
+        return emplace<TypeAt<I>>(std::forward<Args>(args)...);
     }
 
-    template <typename... Types>
-    template <typename... SourceTypes>
-    inline auto Variant<Types...>::operator=(Variant<SourceTypes...>&& source) -> Variant&
+    template <typename Policy, typename... Types>
+    template <typename SourcePolicy, typename... SourceTypes>
+    BasicVariant<Policy, Types...>::BasicVariant(BasicVariant<SourcePolicy, SourceTypes...>&& source)
     {
-        return assignFrom(std::move(source));
+        copyFromIfNotEmpty(std::move(source));
     }
 
-    template <typename... Types>
-    inline auto Variant<Types...>::operator=(const Variant& source) -> Variant&
+    template <typename Policy, typename... Types>
+    template <typename SourcePolicy, typename... SourceTypes>
+    BasicVariant<Policy, Types...>::BasicVariant(const BasicVariant<SourcePolicy, SourceTypes...>& source)
     {
-        return assignFrom(source);
+        copyFromIfNotEmpty(source);
     }
 
-    template <typename... Types>
-    template <typename... SourceTypes>
-    inline auto Variant<Types...>::operator=(const Variant<SourceTypes...>& source) -> Variant&
+    template <typename Policy, typename... Types>
+    template <typename VariantT>
+    inline void BasicVariant<Policy, Types...>::copyFromIfNotEmpty(VariantT&& source)
+    {
+        if (!source.isEmpty())
+        {
+            copyFrom(std::forward<VariantT>(source));
+        }
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename VariantT>
+    void BasicVariant<Policy, Types...>::copyFrom(VariantT&& source)
+    {
+        assert(!source.isEmpty());
+
+        //boxes are copied as they are, visit would pass their values instead
+        Detail::dispatch<void, Detail::WithEmptyAlternative<VariantT>>([&](auto alternative)
+        {
+            using T = typename decltype(alternative)::type;
+
+            if constexpr (!std::is_same_v<T, Detail::NoValue>)
+            {
+                *this = Detail::VariantAccess::get<T>(std::forward<VariantT>(source));
+            }
+        }, Detail::VariantAccess::getDiscriminator(source));
+    }
+
+    template <typename Policy, typename... Types>
+    inline bool BasicVariant<Policy, Types...>::isEmpty() const noexcept
+    {
+        return this->getDiscriminator() == NO_VALUE_DISCRIMINATOR;
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename SourcePolicy, typename... SourceTypes>
+    inline auto BasicVariant<Policy, Types...>::operator=(BasicVariant<SourcePolicy, SourceTypes...>&& source) -> BasicVariant&
+    {
+        return assignFrom(std::move(source));
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename SourcePolicy, typename... SourceTypes>
+    inline auto BasicVariant<Policy, Types...>::operator=(const BasicVariant<SourcePolicy, SourceTypes...>& source) -> BasicVariant&
     {
         return assignFrom(source);
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename VariantT>
-    auto Variant<Types...>::assignFrom(VariantT&& source) -> Variant&
+    auto BasicVariant<Policy, Types...>::assignFrom(VariantT&& source) -> BasicVariant&
     {
         if (!source.isEmpty())
         {
@@ -112,107 +162,180 @@ namespace IDragnev
         }
         else
         {
-            destroyValue();
+            this->destroyValue();
         }
 
         return *this;
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename T>
-    bool Variant<Types...>::is() const noexcept
+    inline bool BasicVariant<Policy, Types...>::is() const noexcept
     {
         return this->getDiscriminator() == VChoice<T>::discriminator;
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename T>
-    inline T&& Variant<Types...>::get() &&
+    inline T&& BasicVariant<Policy, Types...>::get() &&
     {
         return std::move(get<T>());
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename T>
-    inline T& Variant<Types...>::get() &
+    inline T& BasicVariant<Policy, Types...>::get() &
     {
         return const_cast<T&>(std::as_const(*this).template get<T>());
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename T>
-    const T& Variant<Types...>::get() const &
+    const T& BasicVariant<Policy, Types...>::get() const &
     {
         if (isEmpty())
         {
-            throw EmptyVariant{};
+            Detail::fail(EmptyVariant{});
         }
 
+        return getUnchecked<T>();
+    }
+
+    template <typename Policy, typename... Types>
+    template <std::size_t I>
+    inline auto BasicVariant<Policy, Types...>::get() & -> TypeAt<I>&
+    {
+        return get<TypeAt<I>>();
+    }
+
+    template <typename Policy, typename... Types>
+    template <std::size_t I>
+    inline auto BasicVariant<Policy, Types...>::get() && -> TypeAt<I>&&
+    {
+        return std::move(*this).template get<TypeAt<I>>();
+    }
+
+    template <typename Policy, typename... Types>
+    template <std::size_t I>
+    inline auto BasicVariant<Policy, Types...>::get() const & -> const TypeAt<I>&
+    {
+        return get<TypeAt<I>>();
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline T* BasicVariant<Policy, Types...>::getIf() noexcept
+    {
+        return const_cast<T*>(std::as_const(*this).template getIf<T>());
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline const T* BasicVariant<Policy, Types...>::getIf() const noexcept
+    {
+        return is<T>() ? this->template getBufferAs<T>() : nullptr;
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline T& BasicVariant<Policy, Types...>::getUnchecked() & noexcept
+    {
+        return const_cast<T&>(std::as_const(*this).template getUnchecked<T>());
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline T&& BasicVariant<Policy, Types...>::getUnchecked() && noexcept
+    {
+        return std::move(getUnchecked<T>());
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline const T& BasicVariant<Policy, Types...>::getUnchecked() const & noexcept
+    {
         assert(is<T>());
         return *(this->template getBufferAs<T>());
     }
 
+    template <typename Policy, typename... Types>
+    inline std::size_t BasicVariant<Policy, Types...>::index() const noexcept
+    {
+        return this->getDiscriminator();
+    }
+
     namespace Detail 
     {
         template <typename R,
-                  typename V,
                   typename Visitor,
-                  typename Head,
-                  typename... Tail
-        > R variantVisit(V&& variant, Visitor&& visitor, Meta::TypeList<Head, Tail...>)
+                  typename... Variants
+        > R variantVisit(Visitor&& visitor, Variants&&... variants)
         {
-            if (variant.template is<Head>())
-            {
-                return static_cast<R>(
-                    std::invoke(std::forward<Visitor>(visitor),
-                                std::forward<V>(variant).template get<Head>()));
-            }
-            else if constexpr (sizeof...(Tail) > 0)
-            {
-                return variantVisit<R>(std::forward<V>(variant),
-                                       std::forward<Visitor>(visitor),
-                                       Meta::TypeList<Tail...>{});
-            }
-            else
+            auto f = [&](auto... alternatives) -> R
             {
-                throw EmptyVariant{};
-            }
+                if constexpr ((std::is_same_v<typename decltype(alternatives)::type, NoValue> || ...))
+                {
+                    fail(EmptyVariant{});
+                }
+                else
+                {
+                    return static_cast<R>(
+                        std::invoke(std::forward<Visitor>(visitor),
+                                    unbox(VariantAccess::get<typename decltype(alternatives)::type>(std::forward<Variants>(variants)))...));
+                }
+            };
+
+            return dispatch<R, WithEmptyAlternative<Variants>...>(f, VariantAccess::getDiscriminator(variants)...);
         }
     }
 
-    template <typename R = Detail::DeduceResultType,
+    template <typename R,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, Types&...> 
-    visit(Variant<Types...>& variant, Visitor&& v)
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&>...> 
+    visit(BasicVariant<Policy, Types...>& variant, Visitor&& v)
     {
-        using Result = Detail::VisitResult<R, Visitor, Types&...>;
-        return Detail::variantVisit<Result>(variant,
-                                            std::forward<Visitor>(v),
-                                            Meta::TypeList<Types...>{});
+        using Result = Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&>...>;
+        return Detail::variantVisit<Result>(std::forward<Visitor>(v), variant);
     }
         
-    template <typename R = Detail::DeduceResultType,
+    template <typename R,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, const Types&...>
-    visit(const Variant<Types...>& variant, Visitor&& v)
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<const Types&>...>
+    visit(const BasicVariant<Policy, Types...>& variant, Visitor&& v)
     {
-        using Result = Detail::VisitResult<R, Visitor, const Types&...>;
-        return Detail::variantVisit<Result>(variant, 
-                                            std::forward<Visitor>(v),
-                                            Meta::TypeList<Types...>{});
+        using Result = Detail::VisitResult<R, Visitor, Detail::Unboxed<const Types&>...>;
+        return Detail::variantVisit<Result>(std::forward<Visitor>(v), variant);
     }
         
-    template <typename R = Detail::DeduceResultType,
+    template <typename R,
+              typename Policy,
               typename... Types,
               typename Visitor
-    > Detail::VisitResult<R, Visitor, Types&&...>
-    visit(Variant<Types...>&& variant, Visitor&& v)
+    > Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&&>...>
+    visit(BasicVariant<Policy, Types...>&& variant, Visitor&& v)
+    {
+        using Result = Detail::VisitResult<R, Visitor, Detail::Unboxed<Types&&>...>;
+        return Detail::variantVisit<Result>(std::forward<Visitor>(v), std::move(variant));
+    }
+
+    template <typename R,
+              typename Visitor,
+              typename V,
+              typename... Variants,
+              typename
+    > Detail::CartesianVisitResult<R, Visitor, Detail::QualifiedAlternatives<V>, Detail::QualifiedAlternatives<Variants>...>
+    visit(Visitor&& v, V&& variant, Variants&&... rest)
     {
-        using Result = Detail::VisitResult<R, Visitor, Types&&...>;
-        return Detail::variantVisit<Result>(std::move(variant),
-                                            std::forward<Visitor>(v),
-                                            Meta::TypeList<Types...>{});
+        using Result = Detail::CartesianVisitResult<R,
+                                                    Visitor,
+                                                    Detail::QualifiedAlternatives<V>,
+                                                    Detail::QualifiedAlternatives<Variants>...>;
+        return Detail::variantVisit<Result>(std::forward<Visitor>(v),
+                                            std::forward<V>(variant),
+                                            std::forward<Variants>(rest)...);
     }
 }
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "NicheTraits.hpp"
+#include "meta/ListAlgorithms.hpp"
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace IDragnev::Detail
+{
+    //the narrowest type which holds every discriminator: one per alternative and 0 for no value
+    template <std::size_t AlternativesCount>
+    using DiscriminatorFor = std::conditional_t<(AlternativesCount <= std::numeric_limits<std::uint8_t>::max()),
+                                                std::uint8_t,
+                                                std::conditional_t<(AlternativesCount <= std::numeric_limits<std::uint16_t>::max()),
+                                                                   std::uint16_t,
+                                                                   std::uint32_t>>;
+
+    constexpr std::size_t roundUpToPowerOfTwo(std::size_t n) noexcept
+    {
+        auto result = std::size_t{ 1 };
+        while (result < n)
+        {
+            result *= 2;
+        }
+        return result;
+    }
+
+    //the buffer is followed by a separate discriminator
+    template <typename... Types>
+    class TaggedLayout
+    {
+    private:
+        using LargestT = Meta::LargestType<Meta::TypeList<Types...>>;
+
+    public:
+        using Discriminator = DiscriminatorFor<sizeof...(Types)>;
+
+        static constexpr Discriminator NO_VALUE_DISCRIMINATOR = 0;
+        static constexpr bool storesTagInValue = false;
+
+        Discriminator getDiscriminator() const noexcept;
+        void setDiscriminator(Discriminator d) noexcept;
+
+        void* getRawBuffer() noexcept;
+        const void* getRawBuffer() const noexcept;
+
+    private:
+        alignas(Types...) unsigned char buffer[sizeof(LargestT)];
+        Discriminator discriminator = NO_VALUE_DISCRIMINATOR;
+    };
+
+    //the discriminator is encoded in the niche of Carrier (see NicheTraits):
+    //a valid value there means Carrier is held, an invalid pattern names any other state
+    template <typename Carrier, typename... Types>
+    class NicheLayout
+    {
+    private:
+        using Niche = NicheTraits<Carrier>;
+
+    public:
+        using Discriminator = DiscriminatorFor<sizeof...(Types)>;
+
+        static constexpr Discriminator NO_VALUE_DISCRIMINATOR = 0;
+        static constexpr bool storesTagInValue = true;
+
+        NicheLayout() noexcept;
+
+        Discriminator getDiscriminator() const noexcept;
+        void setDiscriminator(Discriminator d) noexcept;
+
+        void* getRawBuffer() noexcept;
+        const void* getRawBuffer() const noexcept;
+
+    private:
+        static constexpr Discriminator carrierDiscriminator = Meta::indexOf<Carrier, Meta::TypeList<Types...>> + 1;
+
+        alignas(Types...) unsigned char buffer[sizeof(Carrier)];
+    };
+
+    template <typename Carrier, typename... Types>
+    constexpr bool canCarryTagOf() noexcept
+    {
+        using Niche = NicheTraits<Carrier>;
+
+        if constexpr (Niche::count < sizeof...(Types))
+        {
+            return false;
+        }
+        else
+        {
+            return ((std::is_same_v<Types, Carrier> ||
+                     std::is_empty_v<Types> ||
+                     sizeof(Types) <= Niche::offset) && ...);
+        }
+    }
+
+    template <typename... Types>
+    constexpr std::size_t findNicheCarrier() noexcept
+    {
+        constexpr bool canCarry[] = { canCarryTagOf<Types, Types...>()..., true };
+
+        auto result = std::size_t{ 0 };
+        while (!canCarry[result])
+        {
+            ++result;
+        }
+
+        return result;
+    }
+
+    template <typename... Types>
+    struct NicheCarrierT
+    {
+    private:
+        static constexpr auto position = findNicheCarrier<Types...>();
+
+        using Result = std::conditional_t<(position == sizeof...(Types)),
+                                          Meta::IdentityT<void>,
+                                          Meta::ListRefT<Meta::TypeList<Types...>, position>>;
+    public:
+        using type = typename Result::type;
+    };
+
+    template <typename... Types>
+    using NicheCarrier = typename NicheCarrierT<Types...>::type;
+
+    template <typename... Types>
+    using VariantLayout = std::conditional_t<std::is_void_v<NicheCarrier<Types...>>,
+                                             TaggedLayout<Types...>,
+                                             NicheLayout<NicheCarrier<Types...>, Types...>>;
+
+    template <typename... Types>
+    inline
+    auto TaggedLayout<Types...>::getDiscriminator() const noexcept -> Discriminator
+    {
+        return discriminator;
+    }
+
+    template <typename... Types>
+    inline
+    void TaggedLayout<Types...>::setDiscriminator(Discriminator d) noexcept
+    {
+        discriminator = d;
+    }
+
+    template <typename... Types>
+    inline
+    void* TaggedLayout<Types...>::getRawBuffer() noexcept
+    {
+        return buffer;
+    }
+
+    template <typename... Types>
+    inline
+    const void* TaggedLayout<Types...>::getRawBuffer() const noexcept
+    {
+        return buffer;
+    }
+
+    template <typename Carrier, typename... Types>
+    inline NicheLayout<Carrier, Types...>::NicheLayout() noexcept
+    {
+        setDiscriminator(NO_VALUE_DISCRIMINATOR);
+    }
+
+    template <typename Carrier, typename... Types>
+    inline
+    auto NicheLayout<Carrier, Types...>::getDiscriminator() const noexcept -> Discriminator
+    {
+        const auto pattern = Niche::load(buffer + Niche::offset);
+
+        if (pattern == Niche::count)
+        {
+            return carrierDiscriminator;
+        }
+
+        return static_cast<Discriminator>((pattern < carrierDiscriminator) ? pattern : pattern + 1);
+    }
+
+    template <typename Carrier, typename... Types>
+    inline
+    void NicheLayout<Carrier, Types...>::setDiscriminator(Discriminator d) noexcept
+    {
+        if (d != carrierDiscriminator)
+        {
+            Niche::store(buffer + Niche::offset, (d < carrierDiscriminator) ? d : d - 1);
+        }
+    }
+
+    template <typename Carrier, typename... Types>
+    inline
+    void* NicheLayout<Carrier, Types...>::getRawBuffer() noexcept
+    {
+        return buffer;
+    }
+
+    template <typename Carrier, typename... Types>
+    inline
+    const void* NicheLayout<Carrier, Types...>::getRawBuffer() const noexcept
+    {
+        return buffer;
+    }
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "Variant.hpp"
+#include "ErrorPolicy.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace IDragnev
+{
+    //A bounded lock-free queue of values of any of Types for many producers and many consumers.
+    //Values are constructed directly in the slots of the ring and visited there,
+    //so a value is never copied or moved on its way through the queue.
+    //The slots are claimed as in the bounded MPMC queue of D. Vyukov: each slot has a sequence
+    //which tells whether it is free for the producer or filled for the consumer of a given lap.
+    template <typename... Types>
+    class VariantRing
+    {
+    private:
+        static_assert(sizeof...(Types) > 0, "VariantRing needs at least one type");
+        static_assert((std::is_nothrow_destructible_v<Types> && ...), "the types of VariantRing must be nothrow destructible");
+
+        using Storage = Detail::VariantStorage<InlineStorage, Types...>;
+        using Alternatives = Meta::TypeList<Detail::NoValue, Types...>;
+
+        static constexpr std::size_t cacheLineSize = 64;
+
+        struct alignas(cacheLineSize) Slot
+        {
+            std::atomic<std::size_t> sequence;
+            Storage storage;
+        };
+
+        struct alignas(cacheLineSize) Position
+        {
+            std::atomic<std::size_t> value{ 0 };
+        };
+
+    public:
+        //capacity is rounded up to a power of two
+        explicit VariantRing(std::size_t capacity);
+        VariantRing(const VariantRing&) = delete;
+        ~VariantRing();
+
+        VariantRing& operator=(const VariantRing&) = delete;
+
+        std::size_t capacity() const noexcept;
+
+        //constructs a T at the back of the queue, returns false if the queue is full
+        template <typename T, typename... Args>
+        bool tryEmplace(Args&&... args);
+
+        //calls visitor with the value at the front of the queue and destroys the value,
+        //returns false if the queue is empty
+        template <typename Visitor>
+        bool tryConsume(Visitor&& visitor);
+
+        //the same, but wait for a free slot or a value
+        template <typename T, typename... Args>
+        void emplace(Args&&... args);
+
+        template <typename Visitor>
+        void consume(Visitor&& visitor);
+
+    private:
+        //claims the slot at position if its sequence is position + lag,
+        //returns nullptr if the queue is full (for producers) or empty (for consumers)
+        Slot* claim(Position& position, std::size_t lag, std::size_t& claimed) noexcept;
+
+        template <typename Visitor>
+        static void visitValue(Storage& storage, Visitor& visitor);
+
+    private:
+        std::unique_ptr<Slot[]> slots;
+        std::size_t mask;
+        Position back;
+        Position front;
+    };
+
+    template <typename... Types>
+    VariantRing<Types...>::VariantRing(std::size_t capacity) :
+        mask(Detail::roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity) - 1)
+    {
+        slots = std::make_unique<Slot[]>(mask + 1);
+
+        for (auto i = std::size_t{ 0 }; i <= mask; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename... Types>
+    VariantRing<Types...>::~VariantRing()
+    {
+        //the queue is not used concurrently any more, only the filled slots hold values
+        for (auto i = std::size_t{ 0 }; i <= mask; ++i)
+        {
+            slots[i].storage.destroyValue();
+        }
+    }
+
+    template <typename... Types>
+    inline std::size_t VariantRing<Types...>::capacity() const noexcept
+    {
+        return mask + 1;
+    }
+
+    template <typename... Types>
+    auto VariantRing<Types...>::claim(Position& position, std::size_t lag, std::size_t& claimed) noexcept -> Slot*
+    {
+        auto current = position.value.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& slot = slots[current & mask];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence - (current + lag));
+
+            if (difference == 0)
+            {
+                if (position.value.compare_exchange_weak(current, current + 1, std::memory_order_relaxed))
+                {
+                    claimed = current;
+                    return &slot;
+                }
+            }
+            else if (difference < 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                current = position.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template <typename... Types>
+    template <typename T, typename... Args>
+    bool VariantRing<Types...>::tryEmplace(Args&&... args)
+    {
+        static_assert(Meta::isMember<T, Meta::TypeList<Types...>>, "T is not an alternative of the VariantRing");
+
+        auto position = std::size_t{ 0 };
+        const auto slot = claim(back, 0, position);
+
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        //a slot left empty by a throwing constructor is still published, consumers skip it
+        IDRAGNEV_TRY
+        {
+            slot->storage.template construct<T>(std::forward<Args>(args)...);
+        }
+        IDRAGNEV_CATCH_ALL
+        {
+            slot->sequence.store(position + 1, std::memory_order_release);
+            IDRAGNEV_RETHROW;
+        }
+
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename... Types>
+    template <typename Visitor>
+    void VariantRing<Types...>::visitValue(Storage& storage, Visitor& visitor)
+    {
+        Detail::dispatch<void, Alternatives>([&](auto alternative)
+        {
+            using T = typename decltype(alternative)::type;
+
+            if constexpr (!std::is_same_v<T, Detail::NoValue>)
+            {
+                std::invoke(visitor, Detail::unbox(Detail::VariantAccess::get<T>(storage)));
+            }
+        }, storage.getDiscriminator());
+    }
+
+    template <typename... Types>
+    template <typename Visitor>
+    bool VariantRing<Types...>::tryConsume(Visitor&& visitor)
+    {
+        for (;;)
+        {
+            auto position = std::size_t{ 0 };
+            const auto slot = claim(front, 1, position);
+
+            if (slot == nullptr)
+            {
+                return false;
+            }
+
+            const auto hasValue = slot->storage.getDiscriminator() != Storage::NO_VALUE_DISCRIMINATOR;
+
+            IDRAGNEV_TRY
+            {
+                visitValue(slot->storage, visitor);
+            }
+            IDRAGNEV_CATCH_ALL
+            {
+                slot->storage.destroyValue();
+                slot->sequence.store(position + capacity(), std::memory_order_release);
+                IDRAGNEV_RETHROW;
+            }
+
+            slot->storage.destroyValue();
+            slot->sequence.store(position + capacity(), std::memory_order_release);
+
+            if (hasValue)
+            {
+                return true;
+            }
+        }
+    }
+
+    template <typename... Types>
+    template <typename T, typename... Args>
+    void VariantRing<Types...>::emplace(Args&&... args)
+    {
+        //the arguments are forwarded by the call which succeeds only
+        while (!tryEmplace<T>(std::forward<Args>(args)...))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename... Types>
+    template <typename Visitor>
+    void VariantRing<Types...>::consume(Visitor&& visitor)
+    {
+        while (!tryConsume(visitor))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
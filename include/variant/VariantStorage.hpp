@@ -1,75 +1,267 @@
 #pragma once
 
 #include <new>
+#include <type_traits>
+#include <utility>
 #include "meta/ListAlgorithms.hpp"
+#include "VariantDispatch.hpp"
+#include "VariantLayout.hpp"
+#include "StoragePolicy.hpp"
+#include "ErrorPolicy.hpp"
 
 namespace IDragnev::Detail
 {
-    template <typename... Types>
-    class VariantStorage
+    template <typename Policy, typename... Types>
+    class VariantStorage : public VariantLayout<StoredAlternative<Policy, Types>...>,
+                           public PolicyState<Policy>
     {
     private:
-        using LargestT = Meta::LargestType<Meta::TypeList<Types...>>;
-        
+        using Layout = VariantLayout<StoredAlternative<Policy, Types>...>;
+        using Alternatives = Meta::TypeList<NoValue, Types...>;
+
+        template <typename T>
+        using Stored = StoredAlternative<Policy, T>;
+
     public:
-        unsigned char getDiscriminator() const noexcept;
-        void setDiscriminator(unsigned char d) noexcept;
-        
-        void* getRawBuffer() noexcept;
-        const void* getRawBuffer() const noexcept;
+        using typename Layout::Discriminator;
+        using Layout::NO_VALUE_DISCRIMINATOR;
+
+    private:
+        template <typename T>
+        static constexpr Discriminator discriminatorOf = Meta::indexOf<T, Meta::TypeList<Types...>> + 1;
 
+    public:
         template <typename T>
         T* getBufferAs() noexcept;
 
         template <typename T>
         const T* getBufferAs() const noexcept;
 
+        template <typename T, typename... Args>
+        void construct(Args&&... args);
+        void destroyValue() noexcept;
+        template <typename StorageT>
+        void constructFrom(StorageT&& source);
+        template <typename StorageT>
+        void constructValueFrom(StorageT&& source);
+        template <typename StorageT>
+        void assignFrom(StorageT&& source);
+
     private:
-        alignas(Types...) unsigned char buffer[sizeof(LargestT)];
-        unsigned char discriminator = 0;
+        template <typename T>
+        Stored<T>* getStoredAs() noexcept;
+
+        template <typename T>
+        const Stored<T>* getStoredAs() const noexcept;
+
+        template <typename T, typename... Args>
+        void constructStored(Args&&... args);
     };
 
-    template <typename... Types>
+    struct VariantAccess
+    {
+        template <typename V>
+        static auto getDiscriminator(const V& variant) noexcept
+        {
+            return variant.getDiscriminator();
+        }
+
+        template <typename T, typename V>
+        static decltype(auto) get(V&& variant) noexcept
+        {
+            auto& value = *variant.template getBufferAs<T>();
+
+            if constexpr (std::is_lvalue_reference_v<V>)
+            {
+                return value;
+            }
+            else
+            {
+                return std::move(value);
+            }
+        }
+    };
+
+    template <typename Policy, typename... Types>
+    template <typename T>
     inline
-    unsigned char VariantStorage<Types...>::getDiscriminator() const noexcept 
+    auto VariantStorage<Policy, Types...>::getStoredAs() noexcept -> Stored<T>*
     {
-        return discriminator;
+        return std::launder(reinterpret_cast<Stored<T>*>(this->getRawBuffer()));
     }
 
-    template <typename... Types>
-    inline 
-    void VariantStorage<Types...>::setDiscriminator(unsigned char d) noexcept
-    {
-        discriminator = d;
-    }   
-    
-    template <typename... Types>
+    template <typename Policy, typename... Types>
+    template <typename T>
     inline
-    void* VariantStorage<Types...>::getRawBuffer() noexcept
+    auto VariantStorage<Policy, Types...>::getStoredAs() const noexcept -> const Stored<T>*
     {
-        return buffer;
+        return std::launder(reinterpret_cast<const Stored<T>*>(this->getRawBuffer()));
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
+    template <typename T>
     inline
-    const void* VariantStorage<Types...>::getRawBuffer() const noexcept 
+    T* VariantStorage<Policy, Types...>::getBufferAs() noexcept
     {
-        return buffer;
+        return const_cast<T*>(std::as_const(*this).template getBufferAs<T>());
     }
 
-    template <typename... Types>
+    template <typename Policy, typename... Types>
     template <typename T>
-    inline 
-    T* VariantStorage<Types...>::getBufferAs() noexcept
+    inline
+    const T* VariantStorage<Policy, Types...>::getBufferAs() const noexcept
     {
-        return std::launder(reinterpret_cast<T*>(buffer));
+        if constexpr (Policy::template spills<T>)
+        {
+            return getStoredAs<T>()->get();
+        }
+        else
+        {
+            return getStoredAs<T>();
+        }
     }
 
-    template <typename... Types>
-    template <typename T>
-    inline 
-    const T* VariantStorage<Types...>::getBufferAs() const noexcept
+    template <typename Policy, typename... Types>
+    template <typename T, typename... Args>
+    inline void VariantStorage<Policy, Types...>::construct(Args&&... args)
     {
-        return std::launder(reinterpret_cast<const T*>(buffer));
+        if constexpr (Policy::template spills<T>)
+        {
+            constructStored<T>(std::in_place, std::forward<Args>(args)...);
+        }
+        else if constexpr (usesPolicyAllocator<T, Policy>)
+        {
+            const auto allocator = this->getAllocator();
+
+            if constexpr (std::is_constructible_v<T, std::allocator_arg_t, decltype(allocator), Args...>)
+            {
+                constructStored<T>(std::allocator_arg, allocator, std::forward<Args>(args)...);
+            }
+            else
+            {
+                static_assert(std::is_constructible_v<T, Args..., decltype(allocator)>,
+                              "T uses an allocator but cannot be constructed with one");
+                constructStored<T>(std::forward<Args>(args)..., allocator);
+            }
+        }
+        else
+        {
+            constructStored<T>(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T, typename... Args>
+    void VariantStorage<Policy, Types...>::constructStored(Args&&... args)
+    {
+        if constexpr (Layout::storesTagInValue && !std::is_nothrow_constructible_v<Stored<T>, Args...>)
+        {
+            //a partially constructed T may have left a valid value in the niche
+            IDRAGNEV_TRY
+            {
+                new(this->getRawBuffer()) Stored<T>(std::forward<Args>(args)...);
+            }
+            IDRAGNEV_CATCH_ALL
+            {
+                this->setDiscriminator(NO_VALUE_DISCRIMINATOR);
+                IDRAGNEV_RETHROW;
+            }
+        }
+        else
+        {
+            new(this->getRawBuffer()) Stored<T>(std::forward<Args>(args)...);
+        }
+
+        this->setDiscriminator(discriminatorOf<T>);
+    }
+
+    template <typename Policy, typename... Types>
+    void VariantStorage<Policy, Types...>::destroyValue() noexcept
+    {
+        dispatch<void, Alternatives>([this](auto alternative)
+        {
+            using T = typename decltype(alternative)::type;
+
+            if constexpr (!std::is_same_v<T, NoValue>)
+            {
+                getStoredAs<T>()->~Stored<T>();
+            }
+        }, this->getDiscriminator());
+
+        this->setDiscriminator(NO_VALUE_DISCRIMINATOR);
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename StorageT>
+    inline void VariantStorage<Policy, Types...>::constructFrom(StorageT&& source)
+    {
+        this->adopt(source);
+        constructValueFrom(std::forward<StorageT>(source));
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename StorageT>
+    void VariantStorage<Policy, Types...>::constructValueFrom(StorageT&& source)
+    {
+        constexpr auto isMove = !std::is_lvalue_reference_v<StorageT>;
+
+        dispatch<void, Alternatives>([&](auto alternative)
+        {
+            using T = typename decltype(alternative)::type;
+
+            if constexpr (std::is_same_v<T, NoValue>)
+            {
+                return;
+            }
+            else if constexpr (Policy::template spills<T>)
+            {
+                if constexpr (isMove)
+                {
+                    //the slot is taken from the source, which is left without a value
+                    constructStored<T>(std::move(*source.template getStoredAs<T>()));
+                    source.destroyValue();
+                }
+                else
+                {
+                    constructStored<T>(*source.template getStoredAs<T>());
+                }
+            }
+            else
+            {
+                construct<T>(VariantAccess::get<T>(std::forward<StorageT>(source)));
+            }
+        }, source.getDiscriminator());
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename StorageT>
+    void VariantStorage<Policy, Types...>::assignFrom(StorageT&& source)
+    {
+        const auto discriminator = this->getDiscriminator();
+
+        if (discriminator == source.getDiscriminator())
+        {
+            dispatch<void, Alternatives>([&](auto alternative)
+            {
+                using T = typename decltype(alternative)::type;
+
+                if constexpr (!std::is_same_v<T, NoValue>)
+                {
+                    if constexpr (std::is_lvalue_reference_v<StorageT>)
+                    {
+                        *getStoredAs<T>() = *source.template getStoredAs<T>();
+                    }
+                    else
+                    {
+                        *getStoredAs<T>() = std::move(*source.template getStoredAs<T>());
+                    }
+                }
+            }, discriminator);
+        }
+        else
+        {
+            destroyValue();
+            constructValueFrom(std::forward<StorageT>(source));
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,305 @@
+#pragma once
+
+#include "meta/ListAlgorithms.hpp"
+#include "ErrorPolicy.hpp"
+#include "VariantDispatch.hpp"
+#include "VariantLayout.hpp"
+#include "VisitResult.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace IDragnev
+{
+    namespace Detail
+    {
+        template <typename T>
+        struct VariantColumn
+        {
+            std::vector<T> values;
+        };
+    }
+
+    //A sequence of values of any of Types, stored as one densely packed column per type.
+    //Each element takes a discriminator (numbered as the alternatives of Variant<Types...>)
+    //and its position in its column, instead of a slot as large as the largest type.
+    //Positions are 32-bit, which halves the per-element overhead on 64-bit targets
+    //and limits each column (not the whole vector) to 2^32 values.
+    //Elements keep their index until they are popped.
+    template <typename... Types>
+    class VariantVector : private Detail::VariantColumn<Types>...
+    {
+    private:
+        static_assert(sizeof...(Types) > 0, "VariantVector needs at least one type");
+        static_assert((!std::is_reference_v<Types> && ...), "VariantVector cannot hold references");
+
+        using Alternatives = Meta::TypeList<Types...>;
+
+        template <typename T>
+        using EnableIfAlternative = std::enable_if_t<Meta::isMember<std::decay_t<T>, Alternatives>>;
+
+    public:
+        using Discriminator = Detail::DiscriminatorFor<sizeof...(Types)>;
+        using Position = std::uint32_t;
+
+        template <typename T>
+        static constexpr Discriminator discriminatorOf = Meta::indexOf<T, Alternatives> + 1;
+
+        VariantVector() = default;
+        VariantVector(const VariantVector& source) = default;
+        VariantVector(VariantVector&& source) = default;
+        ~VariantVector() = default;
+
+        VariantVector& operator=(const VariantVector& rhs) = default;
+        VariantVector& operator=(VariantVector&& rhs) = default;
+
+        template <typename T, typename = EnableIfAlternative<T>>
+        void pushBack(T&& value);
+
+        template <typename T, typename... Args>
+        T& emplaceBack(Args&&... args);
+
+        void popBack();
+        void clear() noexcept;
+        //reserves the discriminators and positions of size elements,
+        //the columns are reserved by reserveOf, as only the caller knows how the elements split among them
+        void reserve(std::size_t size);
+
+        template <typename T>
+        void reserveOf(std::size_t count);
+
+        std::size_t size() const noexcept;
+        bool isEmpty() const noexcept;
+
+        template <typename T>
+        std::size_t countOf() const noexcept;
+
+        template <typename T>
+        bool is(std::size_t i) const noexcept;
+
+        template <typename T>
+        T& get(std::size_t i) noexcept;
+
+        template <typename T>
+        const T& get(std::size_t i) const noexcept;
+
+        //calls f with each value of type T in the order of insertion,
+        //touching the column of T only
+        template <typename T, typename F>
+        void forEachOf(F&& f);
+
+        template <typename T, typename F>
+        void forEachOf(F&& f) const;
+
+        //the result types are deduced in the definitions, so that overload resolution
+        //does not instantiate the visitor with the alternatives of the other overload
+        template <typename R = Detail::DeduceResultType, typename Visitor>
+        decltype(auto) visit(std::size_t i, Visitor&& v);
+
+        template <typename R = Detail::DeduceResultType, typename Visitor>
+        decltype(auto) visit(std::size_t i, Visitor&& v) const;
+
+    private:
+        template <typename T>
+        std::vector<T>& columnOf() noexcept;
+
+        template <typename T>
+        const std::vector<T>& columnOf() const noexcept;
+
+        template <typename R, typename Self, typename Visitor>
+        static R visitAt(Self& self, std::size_t i, Visitor&& v);
+
+    private:
+        std::vector<Discriminator> discriminators;
+        std::vector<Position> positions;
+    };
+
+    template <typename... Types>
+    template <typename T>
+    inline std::vector<T>& VariantVector<Types...>::columnOf() noexcept
+    {
+        return static_cast<Detail::VariantColumn<T>&>(*this).values;
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline const std::vector<T>& VariantVector<Types...>::columnOf() const noexcept
+    {
+        return static_cast<const Detail::VariantColumn<T>&>(*this).values;
+    }
+
+    template <typename... Types>
+    template <typename T, typename>
+    inline void VariantVector<Types...>::pushBack(T&& value)
+    {
+        emplaceBack<std::decay_t<T>>(std::forward<T>(value));
+    }
+
+    template <typename... Types>
+    template <typename T, typename... Args>
+    T& VariantVector<Types...>::emplaceBack(Args&&... args)
+    {
+        static_assert(Meta::isMember<T, Alternatives>, "T is not an alternative of the VariantVector");
+
+        auto& column = columnOf<T>();
+        if (column.size() > std::numeric_limits<Position>::max())
+        {
+            Detail::fail(std::length_error("VariantVector: too many values of a single type"));
+        }
+
+        column.emplace_back(std::forward<Args>(args)...);
+
+        IDRAGNEV_TRY
+        {
+            discriminators.push_back(discriminatorOf<T>);
+            positions.push_back(static_cast<Position>(column.size() - 1));
+        }
+        IDRAGNEV_CATCH_ALL
+        {
+            if (discriminators.size() > positions.size())
+            {
+                discriminators.pop_back();
+            }
+            column.pop_back();
+            IDRAGNEV_RETHROW;
+        }
+
+        return column.back();
+    }
+
+    template <typename... Types>
+    void VariantVector<Types...>::popBack()
+    {
+        assert(!isEmpty());
+
+        //the last element is always the last one of its column
+        Detail::dispatch<void, Alternatives>([this](auto alternative)
+        {
+            using T = typename decltype(alternative)::type;
+            columnOf<T>().pop_back();
+        }, discriminators.back() - 1);
+
+        discriminators.pop_back();
+        positions.pop_back();
+    }
+
+    template <typename... Types>
+    void VariantVector<Types...>::clear() noexcept
+    {
+        (columnOf<Types>().clear(), ...);
+        discriminators.clear();
+        positions.clear();
+    }
+
+    template <typename... Types>
+    inline void VariantVector<Types...>::reserve(std::size_t size)
+    {
+        discriminators.reserve(size);
+        positions.reserve(size);
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline void VariantVector<Types...>::reserveOf(std::size_t count)
+    {
+        static_assert(Meta::isMember<T, Alternatives>, "T is not an alternative of the VariantVector");
+        columnOf<T>().reserve(count);
+    }
+
+    template <typename... Types>
+    inline std::size_t VariantVector<Types...>::size() const noexcept
+    {
+        return discriminators.size();
+    }
+
+    template <typename... Types>
+    inline bool VariantVector<Types...>::isEmpty() const noexcept
+    {
+        return discriminators.empty();
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline std::size_t VariantVector<Types...>::countOf() const noexcept
+    {
+        return columnOf<T>().size();
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline bool VariantVector<Types...>::is(std::size_t i) const noexcept
+    {
+        assert(i < size());
+        return discriminators[i] == discriminatorOf<T>;
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline T& VariantVector<Types...>::get(std::size_t i) noexcept
+    {
+        return const_cast<T&>(std::as_const(*this).template get<T>(i));
+    }
+
+    template <typename... Types>
+    template <typename T>
+    inline const T& VariantVector<Types...>::get(std::size_t i) const noexcept
+    {
+        assert(is<T>(i));
+        return columnOf<T>()[positions[i]];
+    }
+
+    template <typename... Types>
+    template <typename T, typename F>
+    void VariantVector<Types...>::forEachOf(F&& f)
+    {
+        for (auto& value : columnOf<T>())
+        {
+            std::invoke(f, value);
+        }
+    }
+
+    template <typename... Types>
+    template <typename T, typename F>
+    void VariantVector<Types...>::forEachOf(F&& f) const
+    {
+        for (const auto& value : columnOf<T>())
+        {
+            std::invoke(f, value);
+        }
+    }
+
+    template <typename... Types>
+    template <typename R, typename Self, typename Visitor>
+    R VariantVector<Types...>::visitAt(Self& self, std::size_t i, Visitor&& v)
+    {
+        assert(i < self.size());
+
+        return Detail::dispatch<R, Alternatives>([&](auto alternative) -> R
+        {
+            using T = typename decltype(alternative)::type;
+            return static_cast<R>(std::invoke(std::forward<Visitor>(v), self.template columnOf<T>()[self.positions[i]]));
+        }, self.discriminators[i] - 1);
+    }
+
+    template <typename... Types>
+    template <typename R, typename Visitor>
+    inline decltype(auto) VariantVector<Types...>::visit(std::size_t i, Visitor&& v)
+    {
+        using Result = Detail::VisitResult<R, Visitor, Types&...>;
+        return visitAt<Result>(*this, i, std::forward<Visitor>(v));
+    }
+
+    template <typename... Types>
+    template <typename R, typename Visitor>
+    inline decltype(auto) VariantVector<Types...>::visit(std::size_t i, Visitor&& v) const
+    {
+        using Result = Detail::VisitResult<R, Visitor, const Types&...>;
+        return visitAt<Result>(*this, i, std::forward<Visitor>(v));
+    }
+}
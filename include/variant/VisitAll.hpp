@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Variant.hpp"
+
+#include <array>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace IDragnev
+{
+    //The indices of a range of variants grouped by the alternative each variant holds.
+    //The grouping is stable: the indices of each alternative are in increasing order.
+    template <typename V>
+    class AlternativePartition;
+
+    template <typename Policy, typename... Types>
+    class AlternativePartition<BasicVariant<Policy, Types...>>
+    {
+    private:
+        using Alternatives = Meta::TypeList<Detail::NoValue, Types...>;
+        using Discriminator = Detail::DiscriminatorFor<sizeof...(Types)>;
+
+        static constexpr std::size_t bucketsCount = sizeof...(Types) + 1;
+
+        template <typename T>
+        static constexpr std::size_t bucketOf = Meta::indexOf<T, Alternatives>;
+
+    public:
+        template <typename Range>
+        explicit AlternativePartition(const Range& variants);
+
+        std::size_t size() const noexcept;
+        std::size_t countOfEmpty() const noexcept;
+
+        template <typename T>
+        std::size_t countOf() const noexcept;
+
+        //calls f with the index of each variant holding T, in increasing order
+        template <typename T, typename F>
+        void forEachIndexOf(F&& f) const;
+
+    private:
+        std::size_t countIn(std::size_t bucket) const noexcept;
+
+    private:
+        std::vector<std::size_t> indices;
+        std::array<std::size_t, bucketsCount + 1> offsets = {};
+    };
+
+    template <typename Policy, typename... Types>
+    template <typename Range>
+    AlternativePartition<BasicVariant<Policy, Types...>>::AlternativePartition(const Range& variants)
+    {
+        //the variants are read once, the counting sort runs over their discriminators
+        auto discriminators = std::vector<Discriminator>{};
+        discriminators.reserve(static_cast<std::size_t>(std::distance(std::begin(variants), std::end(variants))));
+
+        for (const auto& v : variants)
+        {
+            const auto d = static_cast<Discriminator>(Detail::VariantAccess::getDiscriminator(v));
+            discriminators.push_back(d);
+            ++offsets[d + 1];
+        }
+
+        for (auto bucket = std::size_t{ 1 }; bucket <= bucketsCount; ++bucket)
+        {
+            offsets[bucket] += offsets[bucket - 1];
+        }
+
+        auto next = offsets;
+        indices.resize(discriminators.size());
+
+        for (auto i = std::size_t{ 0 }; i < discriminators.size(); ++i)
+        {
+            indices[next[discriminators[i]]++] = i;
+        }
+    }
+
+    template <typename Policy, typename... Types>
+    inline std::size_t AlternativePartition<BasicVariant<Policy, Types...>>::size() const noexcept
+    {
+        return indices.size();
+    }
+
+    template <typename Policy, typename... Types>
+    inline std::size_t AlternativePartition<BasicVariant<Policy, Types...>>::countIn(std::size_t bucket) const noexcept
+    {
+        return offsets[bucket + 1] - offsets[bucket];
+    }
+
+    template <typename Policy, typename... Types>
+    inline std::size_t AlternativePartition<BasicVariant<Policy, Types...>>::countOfEmpty() const noexcept
+    {
+        return countIn(bucketOf<Detail::NoValue>);
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T>
+    inline std::size_t AlternativePartition<BasicVariant<Policy, Types...>>::countOf() const noexcept
+    {
+        static_assert(Meta::isMember<T, Meta::TypeList<Types...>>, "T is not an alternative of the variant");
+        return countIn(bucketOf<T>);
+    }
+
+    template <typename Policy, typename... Types>
+    template <typename T, typename F>
+    void AlternativePartition<BasicVariant<Policy, Types...>>::forEachIndexOf(F&& f) const
+    {
+        const auto first = indices.data() + offsets[bucketOf<T>];
+        const auto last = indices.data() + offsets[bucketOf<T> + 1];
+
+        for (auto i = first; i != last; ++i)
+        {
+            std::invoke(f, *i);
+        }
+    }
+
+    template <typename Range>
+    AlternativePartition(const Range&) -> AlternativePartition<std::decay_t<decltype(*std::begin(std::declval<const Range&>()))>>;
+
+    namespace Detail
+    {
+        template <typename Range>
+        using RangeReference = decltype(*std::begin(std::declval<Range&>()));
+
+        template <typename Range>
+        using RangeVariant = std::decay_t<RangeReference<Range>>;
+
+        template <typename Range,
+                  typename Visitor,
+                  typename Partition,
+                  typename OnResult,
+                  typename... Types
+        > void visitRuns(Range& variants, Visitor& visitor, const Partition& partition, OnResult onResult, Meta::TypeList<Types...>)
+        {
+            if (partition.countOfEmpty() > 0)
+            {
+                fail(EmptyVariant{});
+            }
+
+            const auto first = std::begin(variants);
+
+            //one loop per alternative, each calling the visitor with a single type
+            (partition.template forEachIndexOf<Types>([&](std::size_t i)
+            {
+                onResult(i, [&]() -> decltype(auto)
+                {
+                    return std::invoke(visitor, unbox(VariantAccess::get<Types>(first[i])));
+                });
+            }), ...);
+        }
+    }
+
+    //Visits each variant of a random access range, grouping the calls by alternative:
+    //first all variants holding the first type, then all holding the second and so on.
+    //The variants holding the same type are visited in their order in the range.
+    template <typename Range, typename Visitor>
+    void visitAll(Range&& variants, Visitor&& visitor)
+    {
+        using V = Detail::RangeVariant<Range>;
+
+        const auto partition = AlternativePartition<V>(variants);
+        Detail::visitRuns(variants, visitor, partition, [](std::size_t, auto call) { call(); }, Detail::VariantAlternatives<V>{});
+    }
+
+    //Same as visitAll, but returns the results in the order of the variants in the range
+    template <typename R = Detail::DeduceResultType, typename Range, typename Visitor>
+    auto visitAllInOrder(Range&& variants, Visitor&& visitor)
+    {
+        using V = Detail::RangeVariant<Range>;
+        using Result = Detail::CartesianVisitResult<R, Visitor&, Detail::QualifiedAlternatives<Detail::RangeReference<Range>>>;
+        static_assert(!std::is_void_v<Result>, "visitAllInOrder needs a result for each variant, use visitAll instead");
+        static_assert(!std::is_reference_v<Result>, "visitAllInOrder stores the results, they cannot be references");
+
+        const auto partition = AlternativePartition<V>(variants);
+        auto results = std::vector<Result>{};
+
+        if constexpr (std::is_default_constructible_v<Result> && std::is_move_assignable_v<Result>)
+        {
+            results.resize(partition.size());
+
+            Detail::visitRuns(variants, visitor, partition, [&results](std::size_t i, auto call)
+            {
+                results[i] = static_cast<Result>(call());
+            }, Detail::VariantAlternatives<V>{});
+        }
+        else
+        {
+            //the results are collected in the order of the calls and then permuted
+            auto grouped = std::vector<Result>{};
+            auto positionInGrouped = std::vector<std::size_t>(partition.size());
+            grouped.reserve(partition.size());
+
+            Detail::visitRuns(variants, visitor, partition, [&](std::size_t i, auto call)
+            {
+                positionInGrouped[i] = grouped.size();
+                grouped.push_back(static_cast<Result>(call()));
+            }, Detail::VariantAlternatives<V>{});
+
+            results.reserve(grouped.size());
+
+            for (const auto position : positionInGrouped)
+            {
+                results.push_back(std::move(grouped[position]));
+            }
+        }
+
+        return results;
+    }
+}
@@ -1,3 +1,4 @@
+#pragma once
 
 #include "meta/ListAlgorithms.hpp"
 
@@ -5,20 +6,70 @@ namespace IDragnev::Detail
 {
     struct DeduceResultType;
 
+    template <typename Visitor,
+              typename BoundArguments,
+              typename... Lists
+    > struct CommonInvokeResultT;
+
+    template <typename Visitor,
+              typename... BoundArguments
+    > struct CommonInvokeResultT<Visitor, Meta::TypeList<BoundArguments...>>
+    {
+        using type = std::invoke_result_t<Visitor, BoundArguments...>;
+    };
+
+    template <typename Visitor,
+              typename... BoundArguments,
+              typename... Types,
+              typename... Lists
+    > struct CommonInvokeResultT<Visitor, Meta::TypeList<BoundArguments...>, Meta::TypeList<Types...>, Lists...>
+    {
+    private:
+        template <typename T>
+        using ResultFor = typename CommonInvokeResultT<Visitor, Meta::TypeList<BoundArguments..., T>, Lists...>::type;
+
+        template <typename First, typename... Rest>
+        static auto common(Meta::TypeList<First, Rest...>)
+        {
+            //std::common_type recurses once per type, which is avoided in the usual case of a single result type,
+            //its result is decayed all the same
+            if constexpr ((std::is_same_v<First, Rest> && ...))
+            {
+                return Meta::IdentityT<std::decay_t<First>>{};
+            }
+            else
+            {
+                return std::common_type<First, Rest...>{};
+            }
+        }
+
+    public:
+        using type = typename decltype(common(Meta::TypeList<ResultFor<Types>...>{}))::type;
+    };
+
     template <typename R,
               typename Visitor,
-              typename... Types
-    > struct VisitResultT
+              typename... Lists
+    > struct CartesianVisitResultT
     {
         using type = R;
     };
 
-    template <typename Visitor, 
+    template <typename Visitor,
+              typename... Lists
+    > struct CartesianVisitResultT<DeduceResultType, Visitor, Lists...> :
+        CommonInvokeResultT<Visitor, Meta::TypeList<>, Lists...>
+    { };
+
+    template <typename R,
+              typename Visitor,
+              typename... Lists
+    > using CartesianVisitResult = typename CartesianVisitResultT<R, Visitor, Lists...>::type;
+
+    template <typename R,
+              typename Visitor,
               typename... Types
-    > struct VisitResultT<DeduceResultType, Visitor, Types...>
-    {
-        using type = std::common_type_t<std::invoke_result_t<Visitor, Types>...>;
-    };
+    > struct VisitResultT : CartesianVisitResultT<R, Visitor, Meta::TypeList<Types...>> { };
 
     template <typename R,
               typename Visitor,
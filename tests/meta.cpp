@@ -3,6 +3,7 @@
 #include "meta/ValueList.hpp"
 #include "meta/Folds.hpp"
 #include <cstdint>
+#include <utility>
 #include <iostream>
 
 namespace IDragnev::Meta
@@ -223,6 +224,72 @@ namespace IDragnev::Meta
     static_assert(countIf<std::is_const, TypeList<int, const int, double>> == 1);
 
     static_assert(indexOf<int, TypeList<int, float, int>> == 0);
+
+    static_assert(indexOf<int, TypeList<float, double, int, int>> == 2);
+
+    static_assert(std::is_same_v<LargestType<TypeList<char, int, unsigned>>, int>);
+
+    template <std::size_t I>
+    struct Indexed
+    {
+        char padding[I + 1];
+    };
+
+    template <typename Indices>
+    struct ManyTypesT;
+
+    template <std::size_t... Is>
+    struct ManyTypesT<std::index_sequence<Is...>>
+    {
+        using type = TypeList<Indexed<Is>...>;
+    };
+
+    using ManyTypes = typename ManyTypesT<std::make_index_sequence<2000>>::type;
+
+    static_assert(indexOf<Indexed<1999>, ManyTypes> == 1999);
+
+    static_assert(isMember<Indexed<1500>, ManyTypes>);
+
+    static_assert(!isMember<int, ManyTypes>);
+
+    static_assert(std::is_same_v<LargestType<ManyTypes>, Indexed<1999>>);
+
+    static_assert(std::is_same_v<ListRef<ManyTypes, 1999>, Indexed<1999>>);
+
+    static_assert(std::is_same_v<ListRef<ManyTypes, 0>, Indexed<0>>);
+
+    static_assert(indexOf<Indexed<1000>, InsertBack<ManyTypes, Indexed<1000>>> == 1000);
+
+    static_assert(!isMember<Indexed<2000>, ManyTypes>);
+
+    static_assert(std::is_same_v<ListRef<ValueList<int, 4, 5, 6>, 2>, CTValue<int, 6>>);
+
+    static_assert(ListRef<MakeIndexList<10'000>, 9'999>::value == 9'999);
+
+    template <typename T, T... Values>
+    constexpr bool holdsValues(ValueList<T, Values...>, std::size_t count, T first, T step)
+    {
+        constexpr T values[] = { Values..., T{} };
+
+        if (sizeof...(Values) != count)
+        {
+            return false;
+        }
+
+        for (auto i = std::size_t{ 0 }; i < sizeof...(Values); ++i)
+        {
+            if (values[i] != first + static_cast<T>(i) * step)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(holdsValues(MakeIndexList<10'000>{}, 10'000, std::size_t{ 0 }, std::size_t{ 1 }));
+
+    static_assert(holdsValues(ReplicateValue<7, 10'000>{}, 10'000, 7, 0));
 }
 
 int main() 
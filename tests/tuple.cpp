@@ -4,6 +4,8 @@
 #include "Tuple.hpp"
 #include "TupleIO.hpp"
 #include "TupleAlgorithms.hpp"
+#include "PackedTuple.hpp"
+#include <cstdint>
 #include <vector>
 
 using namespace IDragnev;
@@ -143,6 +145,157 @@ TEST_CASE("move constructor")
     CHECK(source == makeTuple(1, ""));
 }
 
+TEST_CASE("storage")
+{
+    SUBCASE("special members are trivial when those of the components are")
+    {
+        using Trivial = Tuple<int, double, char>;
+        using NonTrivial = Tuple<int, std::string>;
+
+        static_assert(std::is_trivially_copyable_v<Trivial>);
+        static_assert(std::is_trivially_default_constructible_v<Trivial>);
+        static_assert(std::is_trivially_destructible_v<Trivial>);
+        static_assert(!std::is_trivially_copyable_v<NonTrivial>);
+    }
+
+    SUBCASE("empty components take no space")
+    {
+        struct Empty { };
+
+        static_assert(sizeof(Tuple<Empty, int>) == sizeof(int));
+    }
+
+    SUBCASE("tuples of tuples")
+    {
+        constexpr auto nested = makeTuple(makeTuple(1, 2), 3, makeTuple(4));
+
+        static_assert(get<1>(get<0>(nested)) == 2);
+        static_assert(get<1>(nested) == 3);
+        static_assert(get<0>(get<2>(nested)) == 4);
+    }
+}
+
+TEST_CASE("getHead and getTail")
+{
+    SUBCASE("the tail of an lvalue tuple is a view")
+    {
+        auto tuple = makeTuple(1, "a"s, 2);
+
+        auto tail = tuple.getTail();
+        get<0>(tail) += "b";
+
+        CHECK(tuple.getHead() == 1);
+        CHECK(get<1>(tuple) == "ab");
+        CHECK(&get<1>(tail) == &get<2>(tuple));
+    }
+
+    SUBCASE("the tail of an lvalue tuple compares with tuples")
+    {
+        const auto tuple = makeTuple(1, 2, 3);
+
+        CHECK(tuple.getTail() == makeTuple(2, 3));
+        CHECK(makeTuple(2, 4) != tuple.getTail());
+        CHECK(tuple.getTail() == tuple.getTail());
+        CHECK(tuple.getTail() < makeTuple(3, 4));
+        CHECK(tuple.getTail() <= makeTuple(2, 3));
+    }
+
+    SUBCASE("assigning to the tail of an lvalue tuple assigns its components")
+    {
+        auto tuple = makeTuple(1, "a"s, "b"s);
+        auto other = makeTuple(2, "c"s, "d"s);
+
+        tuple.getTail() = makeTuple("x", "y");
+        CHECK(tuple == makeTuple(1, "x", "y"));
+
+        tuple.getTail() = other.getTail();
+        CHECK(tuple == makeTuple(1, "c", "d"));
+
+        tuple.getTail() = std::move(other).getTail();
+        CHECK(tuple == makeTuple(1, "c", "d"));
+        CHECK(other == makeTuple(2, "", ""));
+    }
+
+    SUBCASE("the tail of an rvalue tuple is moved into a tuple")
+    {
+        auto tuple = makeTuple(1, "a"s, "b"s);
+
+        const auto tail = std::move(tuple).getTail();
+
+        CHECK(tail == makeTuple("a", "b"));
+        CHECK(tuple == makeTuple(1, "", ""));
+    }
+}
+
+TEST_CASE("packed tuple")
+{
+    SUBCASE("takes no more space than the components need")
+    {
+        struct Empty { };
+
+        static_assert(sizeof(Tuple<char, double, char, int>) == 24);
+        static_assert(sizeof(PackedTuple<char, double, char, int>) == 16);
+        static_assert(sizeof(Tuple<char, std::int64_t, short, char, int>) == 24);
+        static_assert(sizeof(PackedTuple<char, std::int64_t, short, char, int>) == 16);
+        static_assert(sizeof(PackedTuple<char, Empty, int>) == sizeof(Tuple<int, char>));
+        static_assert(sizeof(PackedTuple<int, double>) == sizeof(Tuple<double, int>));
+        static_assert(sizeof(PackedTuple<char, char, char>) == 3);
+    }
+
+    SUBCASE("components keep their indices")
+    {
+        constexpr auto tuple = PackedTuple<char, double, char, int>('a', 1.5, 'b', 2);
+
+        static_assert(tupleSize<decltype(tuple)> == 4);
+        static_assert(get<0>(tuple) == 'a');
+        static_assert(get<1>(tuple) == 1.5);
+        static_assert(get<2>(tuple) == 'b');
+        static_assert(get<3>(tuple) == 2);
+        static_assert(get<double>(tuple) == 1.5);
+    }
+
+    SUBCASE("special members are trivial when those of the components are")
+    {
+        using Trivial = PackedTuple<char, double, int>;
+
+        static_assert(std::is_trivially_copyable_v<Trivial>);
+        static_assert(std::is_trivially_default_constructible_v<Trivial>);
+        static_assert(!std::is_trivially_copyable_v<PackedTuple<char, std::string>>);
+    }
+
+    SUBCASE("components are forwarded")
+    {
+        auto name = "name"s;
+        auto tuple = makePackedTuple('a', std::move(name), 1);
+        auto copy = tuple;
+        auto moved = std::move(tuple);
+
+        get<1>(copy) += "s";
+
+        CHECK(name.empty());
+        CHECK(get<1>(moved) == "name");
+        CHECK(get<1>(copy) == "names");
+        CHECK(get<std::string>(moved) == "name");
+    }
+
+    SUBCASE("comparison")
+    {
+        const auto tuple = makePackedTuple('a', 1.5, 2);
+
+        CHECK(tuple == makePackedTuple('a', 1.5, 2));
+        CHECK(tuple != makePackedTuple('a', 1.5, 3));
+        CHECK(PackedTuple<>{} == PackedTuple<>{});
+    }
+
+    SUBCASE("algorithms")
+    {
+        const auto tuple = makePackedTuple('a', 1.5, 2);
+
+        CHECK(foldl(tuple, 0.0, std::plus{}) == 'a' + 3.5);
+        CHECK((tuple | alg::select<2, 0>) == makeTuple(2, 'a'));
+    }
+}
+
 TEST_CASE("copy assignment")
 {
     SUBCASE("basics")
@@ -584,6 +737,55 @@ TEST_CASE("concatenate")
 
         static_assert(result == makeTuple(1, 2, 3, 4, 5, 6));
     }
+
+    SUBCASE("concatenate copies or moves each element exactly once")
+    {
+        struct Counted
+        {
+            Counted(int& copies, int& moves) : copies(&copies), moves(&moves) { }
+            Counted(const Counted& source) : copies(source.copies), moves(source.moves) { ++*copies; }
+            Counted(Counted&& source) : copies(source.copies), moves(source.moves) { ++*moves; }
+
+            int* copies;
+            int* moves;
+        };
+
+        auto copies = 0;
+        auto moves = 0;
+        auto first = makeTuple(Counted(copies, moves), 1);
+        auto second = makeTuple(Counted(copies, moves));
+        auto third = makeTuple(2, Counted(copies, moves));
+        copies = moves = 0;
+
+        const auto copied = concatenate(first, second, third);
+
+        CHECK(copies == 3);
+        CHECK(moves == 0);
+
+        copies = moves = 0;
+        const auto moved = concatenate(std::move(first), std::move(second), std::move(third));
+
+        CHECK(copies == 0);
+        CHECK(moves == 3);
+    }
+
+    SUBCASE("concatenate refers to a last tuple of one component without a temporary")
+    {
+        const auto lhs = makeTuple(1, 2);
+        auto rhs = makeTuple("a"s);
+
+        const auto result = concatenate(lhs, std::move(rhs));
+
+        CHECK(result == makeTuple(1, 2, "a"));
+        CHECK(rhs == makeTuple(""));
+    }
+
+    SUBCASE("concatenate skips empty tuples")
+    {
+        constexpr auto result = concatenate(Tuple<>{}, makeTuple(1, 2), Tuple<>{}, makeTuple(3));
+
+        static_assert(result == makeTuple(1, 2, 3));
+    }
 }
 
 TEST_CASE("tuple comparisions")
@@ -639,4 +841,169 @@ TEST_CASE("pipe")
 
         CHECK(tuple == makeTuple(3, 2, 1));
     }
-} 
\ No newline at end of file
+
+    SUBCASE("piping a tuple into a structural algorithm gives a tuple of copies")
+    {
+        auto source = makeTuple(1, 2, 3);
+
+        auto result = source | take<2>;
+        get<0>(source) = 10;
+
+        static_assert(std::is_same_v<decltype(result), Tuple<int, int>>);
+        CHECK(result == makeTuple(1, 2));
+        CHECK(get<0>(source | take<2>) == 10);
+    }
+
+    SUBCASE("the result does not refer to the piped tuple")
+    {
+        const auto make = []
+        {
+            auto local = makeTuple(std::string(100, 'x'), 2, 3);
+            return local | take<2>;
+        };
+
+        CHECK(make() == makeTuple(std::string(100, 'x'), 2));
+    }
+
+    SUBCASE("a chain of structural algorithms on a view copies the chosen components once")
+    {
+        struct Counted
+        {
+            Counted(int& copies, int& moves) : copies(&copies), moves(&moves) { }
+            Counted(const Counted& source) : copies(source.copies), moves(source.moves) { ++*copies; }
+            Counted(Counted&& source) : copies(source.copies), moves(source.moves) { ++*moves; }
+
+            int* copies;
+            int* moves;
+        };
+
+        auto copies = 0;
+        auto moves = 0;
+        const auto source = replicated<5>(Counted(copies, moves));
+        copies = moves = 0;
+
+        const auto result = asView(source) | drop<1> | take<3> | reverse | materialize;
+
+        static_assert(std::is_same_v<decltype(result), const Tuple<Counted, Counted, Counted>>);
+        CHECK(copies == 3);
+        CHECK(moves == 0);
+    }
+
+    SUBCASE("composed structural algorithms copy the chosen components once")
+    {
+        struct Counted
+        {
+            Counted(int& copies, int& moves) : copies(&copies), moves(&moves) { }
+            Counted(const Counted& source) : copies(source.copies), moves(source.moves) { ++*copies; }
+            Counted(Counted&& source) : copies(source.copies), moves(source.moves) { ++*moves; }
+
+            int* copies;
+            int* moves;
+        };
+
+        auto copies = 0;
+        auto moves = 0;
+        auto source = replicated<5>(Counted(copies, moves));
+        copies = moves = 0;
+
+        const auto copied = source | (drop<1> | take<3> | reverse);
+
+        static_assert(std::is_same_v<decltype(copied), const Tuple<Counted, Counted, Counted>>);
+        CHECK(copies == 3);
+        CHECK(moves == 0);
+
+        copies = 0;
+        const auto moved = std::move(source) | (drop<1> | take<3> | reverse);
+
+        CHECK(copies == 0);
+        CHECK(moves == 3);
+    }
+
+    SUBCASE("structural algorithms compose into one")
+    {
+        auto source = makeTuple(0, 1, 2, 3, 4, 5);
+        constexpr auto middle = drop<1> | take<4> | reverse | alg::select<0, 2>;
+
+        CHECK(middle(source) == makeTuple(4, 2));
+        CHECK((source | middle) == makeTuple(4, 2));
+        CHECK(&get<0>(asView(source) | middle) == &get<4>(source));
+    }
+
+    SUBCASE("a temporary tuple is moved through the stages")
+    {
+        auto source = makeTuple("a"s, "b"s, "c"s);
+
+        const auto result = std::move(source) | drop<1> | reverse;
+
+        CHECK(result == makeTuple("c", "b"));
+        CHECK(source == makeTuple("a", "", ""));
+    }
+
+    SUBCASE("structural algorithms and other functions can be mixed")
+    {
+        const auto source = makeTuple(1, 2, 3, 4, 5);
+        const auto sum = [](const auto& t) { return foldl(t, 0, std::plus{}); };
+        const auto product = [](auto t) { return get<0>(t) * get<1>(t); };
+
+        CHECK((source | reverse | drop<1> | take<2> | sum) == 7);
+        CHECK((source | drop<3> | product) == 20);
+    }
+}
+
+TEST_CASE("views")
+{
+    SUBCASE("a view refers to the components of its source")
+    {
+        auto source = makeTuple(1, "a"s, 2.0);
+
+        auto view = asView(source);
+        get<1>(view) += "b";
+
+        CHECK(&get<0>(view) == &get<0>(source));
+        CHECK(get<1>(source) == "ab");
+        static_assert(tupleSize<decltype(view)> == 3);
+    }
+
+    SUBCASE("structural algorithms on a view give views of the same source")
+    {
+        auto source = makeTuple(0, 1, 2, 3, 4, 5);
+
+        auto view = asView(source) | drop<1> | take<4> | reverse | alg::select<0, 2>;
+
+        static_assert(std::is_same_v<decltype(view), TupleView<Tuple<int, int, int, int, int, int>, 4, 2>>);
+        CHECK(&get<0>(view) == &get<4>(source));
+        CHECK(materialize(view) == makeTuple(4, 2));
+        CHECK(replicate<1, 3>(view).materialize() == makeTuple(2, 2, 2));
+    }
+
+    SUBCASE("sortByType sorts the components of the view")
+    {
+        const auto source = makeTuple(1.0, 'a', 2);
+
+        const auto view = asView(source) | drop<1> | sortByType<Meta::IsSmallerT>;
+
+        CHECK(materialize(view) == makeTuple('a', 2));
+    }
+
+    SUBCASE("the other algorithms accept views")
+    {
+        const auto source = makeTuple(1, 2, 3, 4);
+        const auto view = asView(source) | reverse;
+
+        CHECK(foldl(view, 0, [](auto acc, auto x) { return acc * 10 + x; }) == 4321);
+        CHECK(foldr(view, 0, [](auto x, auto acc) { return acc * 10 + x; }) == 1234);
+        CHECK(apply([](auto... xs) { return (xs + ...); }, view) == 10);
+        CHECK(transform(view, [](auto x) { return x * 2; }) == makeTuple(8, 6, 4, 2));
+        CHECK(concatenate(view | take<2>, makeTuple(0)) == makeTuple(4, 3, 0));
+    }
+
+    SUBCASE("materializing copies the components without changing the source")
+    {
+        auto source = makeTuple("a"s, "b"s, "c"s);
+
+        const auto result = asView(source) | take<2> | materialize;
+
+        CHECK(result == makeTuple("a", "b"));
+        CHECK(source == makeTuple("a", "b", "c"));
+    }
+}
@@ -1,10 +1,39 @@
+#include "ErrorPolicy.hpp"
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#if !IDRAGNEV_HAS_EXCEPTIONS
+    #define DOCTEST_CONFIG_NO_EXCEPTIONS_BUT_WITH_ALL_ASSERTS
+#endif
 #include "doctest.h"
 #include "Variant.hpp"
+#include "VariantVector.hpp"
+#include "VisitAll.hpp"
+#include "AtomicVariant.hpp"
+#include "VariantRing.hpp"
+#include <vector>
+#include <memory_resource>
 #include <string>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 using IDragnev::Variant;
+using IDragnev::BasicVariant;
+using IDragnev::SpillAbove;
+using IDragnev::Box;
+using IDragnev::BoxArena;
+using IDragnev::VariantVector;
+using IDragnev::visitAll;
+using IDragnev::visitAllInOrder;
+using IDragnev::AlternativePartition;
+using IDragnev::AtomicVariant;
+using IDragnev::VariantRing;
 using IDragnev::visit;
+using IDragnev::inPlaceType;
+using IDragnev::inPlaceIndex;
 
 TEST_CASE("the default constructor default-constructs the first type")
 {
@@ -213,6 +242,1265 @@ TEST_CASE("testing visit")
 
         CHECK(result == 10.0);
     }
+
+    SUBCASE("visit reaches every alternative of a larger variant")
+    {
+        using V = Variant<char, short, int, long, float, double, std::string>;
+        
+        CHECK(visit(V('a'), [](const auto& x) { return sizeof(x); }) == sizeof(char));
+        CHECK(visit(V(1.0f), [](const auto& x) { return sizeof(x); }) == sizeof(float));
+        CHECK(visit(V("abc"), [](const auto& x) { return sizeof(x); }) == sizeof(std::string));
+    }
+
+    SUBCASE("the deduced result type is decayed, as by std::common_type")
+    {
+        auto value = 1;
+        const auto toValue = [&value](const auto&) -> int& { return value; };
+        const auto pairToValue = [&value](const auto&, const auto&) -> int& { return value; };
+
+        auto v = Variant<int, double>(2);
+        auto vector = VariantVector<int, double>{};
+        vector.pushBack(3);
+        const auto range = std::vector<Variant<int, double>>{ 4, 5.0 };
+
+        static_assert(std::is_same_v<decltype(visit(v, toValue)), int>);
+        static_assert(std::is_same_v<decltype(visit(pairToValue, v, v)), int>);
+        static_assert(std::is_same_v<decltype(vector.visit(0, toValue)), int>);
+        CHECK(visitAllInOrder(range, toValue) == std::vector<int>{ 1, 1 });
+    }
+}
+
+TEST_CASE("testing visit of several variants")
+{
+    struct Circle { };
+    struct Square { };
+
+    struct Collide
+    {
+        std::string operator()(Circle, Circle) const { return "circle-circle"; }
+        std::string operator()(Circle, Square) const { return "circle-square"; }
+        std::string operator()(Square, Circle) const { return "square-circle"; }
+        std::string operator()(Square, Square) const { return "square-square"; }
+    };
+
+    SUBCASE("the overload for the held alternatives is invoked")
+    {
+        const Variant<Circle, Square> u = Square{};
+        const Variant<Circle, Square> v = Circle{};
+
+        CHECK(visit(Collide{}, u, v) == "square-circle");
+        CHECK(visit(Collide{}, v, u) == "circle-square");
+        CHECK(visit(Collide{}, u, u) == "square-square");
+    }
+
+    SUBCASE("the result type is common to every combination of alternatives")
+    {
+        Variant<int, double> u(1);
+        Variant<char, int, float> v('a');
+        Variant<bool> w(true);
+
+        auto result = visit([](auto x, auto y, auto z) { return x + y + z; }, u, v, w);
+
+        static_assert(std::is_same_v<decltype(result), double>);
+        CHECK(result == 1 + 'a' + 1);
+    }
+
+    SUBCASE("the value category of each variant is preserved")
+    {
+        Variant<int, std::string> u("abc");
+        Variant<int, std::string> v("def");
+
+        auto result = visit([](auto&& x, auto&& y)
+        {
+            using X = decltype(x);
+            using Y = decltype(y);
+
+            static_assert(std::is_lvalue_reference_v<X>);
+            static_assert(std::is_rvalue_reference_v<Y>);
+
+            return std::is_same_v<std::decay_t<X>, std::decay_t<Y>>;
+        }, u, std::move(v));
+
+        CHECK(result);
+        CHECK(v.get<std::string>() == "def");
+    }
+
+    SUBCASE("specifying the return type")
+    {
+        const Variant<int, float> u(1);
+        const Variant<int, float> v(2.5f);
+
+        auto result = visit<double>([](auto x, auto y) { return x * y; }, u, v);
+
+        CHECK(result == 2.5);
+    }
+}
+
+namespace
+{
+    struct Counted
+    {
+        Counted() { ++alive; }
+        Counted(const Counted&) { ++alive; ++copies; }
+        Counted(Counted&&) noexcept { ++alive; ++moves; }
+        ~Counted() { --alive; }
+        Counted& operator=(const Counted&) { ++copyAssignments; return *this; }
+        Counted& operator=(Counted&&) noexcept { ++moveAssignments; return *this; }
+
+        static inline int alive = 0;
+        static inline int copies = 0;
+        static inline int moves = 0;
+        static inline int copyAssignments = 0;
+        static inline int moveAssignments = 0;
+    };
+}
+
+TEST_CASE("copy, move and destruction act on the held alternative only")
+{
+    Counted::alive = Counted::copies = Counted::moves = 0;
+    Counted::copyAssignments = Counted::moveAssignments = 0;
+
+    {
+        Variant<int, Counted, std::string> u = Counted{};
+        Variant<int, Counted, std::string> v = u;
+        Variant<int, Counted, std::string> w = std::move(v);
+
+        CHECK(Counted::alive == 3);
+        CHECK(Counted::copies == 1);
+
+        v = u;
+        w = std::move(u);
+
+        CHECK(Counted::alive == 3);
+        CHECK(Counted::copyAssignments == 1);
+        CHECK(Counted::moveAssignments == 1);
+
+        u = Variant<int, Counted, std::string>("abc");
+        CHECK(Counted::alive == 2);
+
+        v = u;
+        CHECK(Counted::alive == 1);
+        REQUIRE(v.is<std::string>());
+        CHECK(v.get<std::string>() == "abc");
+    }
+
+    CHECK(Counted::alive == 0);
+}
+
+namespace
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Variant<int, float, Point>>);
+    static_assert(std::is_trivially_destructible_v<Variant<int, float, Point>>);
+    static_assert(std::is_trivially_copy_constructible_v<Variant<int, float, Point>>);
+    static_assert(std::is_trivially_move_assignable_v<Variant<int, float, Point>>);
+
+    static_assert(!std::is_trivially_copyable_v<Variant<int, std::string>>);
+    static_assert(!std::is_trivially_destructible_v<Variant<int, std::string>>);
+    static_assert(std::is_nothrow_move_constructible_v<Variant<int, std::string>>);
+}
+
+TEST_CASE("variants of trivially copyable types are trivially copyable")
+{
+    using V = Variant<int, float, Point>;
+
+    const V source = Point{ 1, 2 };
+    V destination(1.0f);
+
+    std::memcpy(static_cast<void*>(&destination), &source, sizeof(V));
+
+    REQUIRE(destination.is<Point>());
+    CHECK(destination.get<Point>().x == 1);
+    CHECK(destination.get<Point>().y == 2);
+}
+
+TEST_CASE("in-place construction")
+{
+    struct Immovable
+    {
+        Immovable(int x, std::string s) : x(x), s(std::move(s)) { }
+        Immovable(Immovable&&) = delete;
+
+        int x;
+        std::string s;
+    };
+
+    SUBCASE("the default constructor does not need a movable first type")
+    {
+        struct DefaultOnly
+        {
+            DefaultOnly() = default;
+            DefaultOnly(DefaultOnly&&) = delete;
+
+            int x = 5;
+        };
+
+        Variant<DefaultOnly, int> v;
+
+        REQUIRE(v.is<DefaultOnly>());
+        CHECK(v.get<DefaultOnly>().x == 5);
+    }
+
+    SUBCASE("constructing by type")
+    {
+        Variant<int, Immovable> v(inPlaceType<Immovable>, 1, "abc");
+
+        REQUIRE(v.is<Immovable>());
+        CHECK(v.get<Immovable>().x == 1);
+        CHECK(v.get<Immovable>().s == "abc");
+    }
+
+    SUBCASE("constructing by index")
+    {
+        Variant<int, std::string> v(inPlaceIndex<1>, 3, 'a');
+
+        REQUIRE(v.is<std::string>());
+        CHECK(v.get<std::string>() == "aaa");
+    }
+
+    SUBCASE("emplace by type replaces the current value")
+    {
+        Variant<int, Immovable> v(10);
+
+        auto& result = v.emplace<Immovable>(2, "def");
+
+        REQUIRE(v.is<Immovable>());
+        CHECK(&result == &v.get<Immovable>());
+        CHECK(result.x == 2);
+        CHECK(result.s == "def");
+    }
+
+    SUBCASE("emplace by index replaces the current value")
+    {
+        Variant<int, std::string> v("abc");
+
+        v.emplace<0>(42);
+
+        REQUIRE(v.is<int>());
+        CHECK(v.get<int>() == 42);
+    }
+
+    SUBCASE("no temporary is built")
+    {
+        Counted::alive = Counted::copies = Counted::moves = 0;
+
+        {
+            Variant<int, Counted> v(inPlaceType<Counted>);
+            v.emplace<Counted>();
+            v.emplace<1>();
+
+            CHECK(Counted::alive == 1);
+        }
+
+        CHECK(Counted::copies == 0);
+        CHECK(Counted::moves == 0);
+        CHECK(Counted::alive == 0);
+    }
+}
+
+namespace
+{
+    enum class Kind : std::uint8_t { request, response, error };
+
+    struct Packet
+    {
+        std::uint32_t id;
+        std::uint16_t length;
+        std::uint8_t flags;
+        Kind kind;
+    };
+
+    struct Fragile
+    {
+        Fragile(int value) : kind(Kind::error)
+        {
+#if IDRAGNEV_HAS_EXCEPTIONS
+            if (value < 0)
+            {
+                throw std::invalid_argument("negative value");
+            }
+#endif
+            this->value = value;
+        }
+
+        int value = 0;
+        Kind kind;
+    };
+
+    struct alignas(8) Node
+    {
+        int value;
+    };
+
+    struct None { };
+}
+
+namespace IDragnev
+{
+    template <>
+    struct NicheTraits<Packet> : ByteNiche<offsetof(Packet, kind), 3> { };
+
+    template <>
+    struct NicheTraits<Fragile> : ByteNiche<offsetof(Fragile, kind), 3> { };
+
+    template <>
+    struct NicheTraits<Node*> : PointerNiche<Node*, alignof(Node)> { };
+}
+
+namespace
+{
+    static_assert(sizeof(Variant<Packet, std::uint32_t, std::uint16_t>) == sizeof(Packet));
+    static_assert(sizeof(Variant<std::uint8_t, Packet, None>) == sizeof(Packet));
+    static_assert(sizeof(Variant<Node*, None>) == sizeof(Node*));
+    static_assert(sizeof(Variant<bool, None>) == sizeof(bool));
+
+    //an alternative overlapping the niche rules it out
+    static_assert(sizeof(Variant<Packet, std::uint64_t>) > sizeof(std::uint64_t));
+    static_assert(sizeof(Variant<int, None>) > sizeof(int));
+
+    static_assert(std::is_trivially_copyable_v<Variant<Packet, std::uint32_t, std::uint16_t>>);
+}
+
+TEST_CASE("variants which store the discriminator in a niche")
+{
+    using V = Variant<std::uint16_t, Packet, std::uint32_t>;
+
+    SUBCASE("each alternative is told apart")
+    {
+        V v = Packet{ 1, 2, 3, Kind::response };
+
+        REQUIRE(v.is<Packet>());
+        CHECK(v.get<Packet>().id == 1);
+        CHECK(v.get<Packet>().kind == Kind::response);
+
+        v = std::uint32_t{ 0xFFFFFFFF };
+        REQUIRE(v.is<std::uint32_t>());
+        CHECK(v.get<std::uint32_t>() == 0xFFFFFFFF);
+
+        v = std::uint16_t{ 7 };
+        REQUIRE(v.is<std::uint16_t>());
+        CHECK(v.get<std::uint16_t>() == 7);
+
+        v.emplace<Packet>(Packet{ 4, 5, 6, Kind::error });
+        REQUIRE(v.is<Packet>());
+        CHECK(v.get<Packet>().kind == Kind::error);
+    }
+
+    SUBCASE("copies and visits work as with a separate discriminator")
+    {
+        const V u = std::uint32_t{ 10 };
+        V v = u;
+
+        REQUIRE(v.is<std::uint32_t>());
+        CHECK(visit(v, [](auto x) { return sizeof(x); }) == sizeof(std::uint32_t));
+    }
+
+    SUBCASE("pointers")
+    {
+        auto node = Node{ 1 };
+        Variant<Node*, None> v(&node);
+
+        REQUIRE(v.is<Node*>());
+        CHECK(v.get<Node*>()->value == 1);
+
+        v = None{};
+        CHECK(v.is<None>());
+
+        v = static_cast<Node*>(nullptr);
+        REQUIRE(v.is<Node*>());
+        CHECK(v.get<Node*>() == nullptr);
+    }
+
+#if IDRAGNEV_HAS_EXCEPTIONS
+    SUBCASE("the variant is empty after the carrier fails to construct")
+    {
+        Variant<std::uint8_t, Fragile> v(std::uint8_t{ 1 });
+
+        CHECK_THROWS_AS(v.emplace<Fragile>(-1), std::invalid_argument);
+        CHECK(v.isEmpty());
+
+        v.emplace<Fragile>(3);
+        REQUIRE(v.is<Fragile>());
+        CHECK(v.get<Fragile>().value == 3);
+    }
+#endif
+}
+
+namespace
+{
+    template <std::size_t I>
+    struct Alternative
+    {
+        std::size_t value = I;
+    };
+
+    template <typename Indices>
+    struct ManyAlternativesT;
+
+    template <std::size_t... Is>
+    struct ManyAlternativesT<std::index_sequence<Is...>>
+    {
+        using type = Variant<Alternative<Is>...>;
+    };
+
+    template <std::size_t N>
+    using ManyAlternatives = typename ManyAlternativesT<std::make_index_sequence<N>>::type;
+
+    template <typename V>
+    std::size_t valueOf(const V& v)
+    {
+        return visit([](const auto& alternative) { return alternative.value; }, v);
+    }
+}
+
+TEST_CASE("variants with more alternatives than a byte can enumerate")
+{
+    using Small = ManyAlternatives<8>;
+    using Large = ManyAlternatives<300>;
+
+    static_assert(std::is_same_v<typename IDragnev::Detail::VariantLayout<bool>::Discriminator, std::uint8_t>);
+    static_assert(std::is_same_v<IDragnev::Detail::DiscriminatorFor<255>, std::uint8_t>);
+    static_assert(std::is_same_v<IDragnev::Detail::DiscriminatorFor<256>, std::uint16_t>);
+    static_assert(std::is_same_v<IDragnev::Detail::DiscriminatorFor<65536>, std::uint32_t>);
+    static_assert(sizeof(Small) == 2 * sizeof(std::size_t));
+    static_assert(sizeof(Large) == 2 * sizeof(std::size_t));
+
+    SUBCASE("the last alternative is reachable")
+    {
+        Large v = Alternative<299>{};
+
+        CHECK(v.is<Alternative<299>>());
+        CHECK(!v.is<Alternative<43>>());
+        CHECK(v.get<Alternative<299>>().value == 299);
+        CHECK(valueOf(v) == 299);
+    }
+
+    SUBCASE("alternatives past the first 255 survive copy and assignment")
+    {
+        Large v = Alternative<257>{};
+        Large copy = v;
+
+        CHECK(valueOf(copy) == 257);
+
+        copy = Alternative<1>{};
+        CHECK(valueOf(copy) == 1);
+
+        copy = v;
+        CHECK(copy.is<Alternative<257>>());
+    }
+}
+
+TEST_CASE("VariantVector")
+{
+    struct Large
+    {
+        std::string name;
+        double payload[16] = {};
+    };
+
+    VariantVector<int, Large> values;
+    values.pushBack(1);
+    values.pushBack(Large{ "first" });
+    values.pushBack(2);
+    values.emplaceBack<Large>(Large{ "second" });
+    values.pushBack(3);
+
+    static_assert(std::is_same_v<VariantVector<int, Large>::Discriminator, std::uint8_t>);
+    static_assert(std::is_same_v<VariantVector<int, Large>::Position, std::uint32_t>);
+
+    SUBCASE("elements keep the index they were inserted at")
+    {
+        REQUIRE(values.size() == 5);
+        CHECK(values.countOf<int>() == 3);
+        CHECK(values.countOf<Large>() == 2);
+
+        CHECK(values.is<int>(0));
+        CHECK(values.is<Large>(3));
+        CHECK(values.get<int>(4) == 3);
+        CHECK(values.get<Large>(3).name == "second");
+    }
+
+    SUBCASE("forEachOf visits a single column in the order of insertion")
+    {
+        auto sum = 0;
+        values.forEachOf<int>([&sum](int& x) { sum = 10 * sum + x; });
+
+        CHECK(sum == 123);
+    }
+
+    SUBCASE("visit by index")
+    {
+        auto describe = [](const auto& value) -> std::string
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>)
+            {
+                return std::to_string(value);
+            }
+            else
+            {
+                return value.name;
+            }
+        };
+
+        CHECK(values.visit(0, describe) == "1");
+        CHECK(values.visit(1, describe) == "first");
+        CHECK(std::as_const(values).visit(3, describe) == "second");
+
+        values.visit(2, [](auto& value)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>)
+            {
+                value = 20;
+            }
+        });
+        CHECK(values.get<int>(2) == 20);
+    }
+
+    SUBCASE("popBack removes the last element from its column")
+    {
+        values.popBack();
+        values.popBack();
+
+        CHECK(values.size() == 3);
+        CHECK(values.countOf<int>() == 2);
+        CHECK(values.countOf<Large>() == 1);
+
+        values.pushBack(Large{ "third" });
+        CHECK(values.get<Large>(3).name == "third");
+    }
+
+    SUBCASE("reserveOf reserves the column of a single type")
+    {
+        values.reserve(values.size() + 8);
+        values.reserveOf<Large>(values.countOf<Large>() + 8);
+        const auto* first = &values.get<Large>(1);
+
+        for (auto i = 0; i < 8; ++i)
+        {
+            values.pushBack(Large{ "more" });
+        }
+
+        CHECK(&values.get<Large>(1) == first);
+        CHECK(values.get<Large>(1).name == "first");
+        CHECK(values.countOf<Large>() == 10);
+    }
+
+    SUBCASE("clear")
+    {
+        values.clear();
+
+        CHECK(values.isEmpty());
+        CHECK(values.countOf<int>() == 0);
+        CHECK(values.countOf<Large>() == 0);
+    }
+}
+
+TEST_CASE("visiting ranges of variants grouped by alternative")
+{
+    using V = Variant<int, std::string, double>;
+
+    const auto variants = std::vector<V>{ 1, std::string("a"), 2.5, 2, std::string("b"), 3 };
+
+    SUBCASE("the partition groups the indices stably")
+    {
+        const auto partition = AlternativePartition(variants);
+        auto ints = std::vector<std::size_t>{};
+        partition.forEachIndexOf<int>([&ints](std::size_t i) { ints.push_back(i); });
+
+        CHECK(partition.size() == 6);
+        CHECK(partition.countOfEmpty() == 0);
+        CHECK(partition.countOf<std::string>() == 2);
+        CHECK(partition.countOf<double>() == 1);
+        CHECK(ints == std::vector<std::size_t>{ 0, 3, 5 });
+    }
+
+    SUBCASE("visitAll visits each alternative in one run")
+    {
+        auto calls = std::string{};
+
+        visitAll(variants, [&calls](const auto& value)
+        {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, int>)            { calls += std::to_string(value); }
+            else if constexpr (std::is_same_v<T, std::string>) { calls += value; }
+            else                                               { calls += "d"; }
+        });
+
+        CHECK(calls == "123abd");
+    }
+
+    SUBCASE("visitAll can modify the variants")
+    {
+        auto copies = variants;
+        visitAll(copies, [](auto& value) { value = value + value; });
+
+        CHECK(copies[3].get<int>() == 4);
+        CHECK(copies[4].get<std::string>() == "bb");
+    }
+
+    SUBCASE("visitAllInOrder keeps the order of the range")
+    {
+        const auto sizes = visitAllInOrder(variants, [](const auto& value) -> std::size_t
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(value)>, std::string>)
+            {
+                return value.size() + 10;
+            }
+            else
+            {
+                return static_cast<std::size_t>(value);
+            }
+        });
+
+        CHECK(sizes == std::vector<std::size_t>{ 1, 11, 2, 2, 11, 3 });
+    }
+
+    SUBCASE("visitAllInOrder with results which are not default constructible")
+    {
+        struct Tag
+        {
+            explicit Tag(char c) : c(c) { }
+            char c;
+        };
+
+        const auto tags = visitAllInOrder(variants, [](const auto& value)
+        {
+            return Tag(std::is_same_v<std::decay_t<decltype(value)>, int> ? 'i' : 'o');
+        });
+
+        auto result = std::string{};
+        for (const auto& tag : tags)
+        {
+            result += tag.c;
+        }
+
+        CHECK(result == "iooioi");
+    }
+
+#if IDRAGNEV_HAS_EXCEPTIONS
+    SUBCASE("empty variants are reported before any visit")
+    {
+        auto withEmpty = std::vector<Variant<int, Fragile>>(3);
+        CHECK_THROWS(withEmpty[1].emplace<Fragile>(-1));
+        auto calls = 0;
+
+        CHECK_THROWS_AS(visitAll(withEmpty, [&calls](const auto&) { ++calls; }), IDragnev::EmptyVariant);
+        CHECK(calls == 0);
+    }
+#endif
+}
+
+namespace
+{
+    struct Bulky
+    {
+        Counted counted;
+        int value = 0;
+        char payload[4096] = {};
+    };
+}
+
+TEST_CASE("alternatives above the spill threshold are held through a pointer")
+{
+    using Spilling = BasicVariant<SpillAbove<32>, int, Bulky>;
+
+    static_assert(sizeof(Spilling) <= 2 * sizeof(void*));
+    static_assert(sizeof(Variant<int, Bulky>) > sizeof(Bulky));
+
+    Counted::alive = 0;
+
+    SUBCASE("get and visit return the spilled value itself")
+    {
+        Spilling v = Bulky{ {}, 7 };
+
+        REQUIRE(v.is<Bulky>());
+        v.get<Bulky>().value = 8;
+
+        CHECK(visit(v, [](const auto& x) -> int
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(x)>, Bulky>) { return x.value; }
+            else                                                           { return x; }
+        }) == 8);
+    }
+
+    SUBCASE("copies are deep")
+    {
+        Spilling u = Bulky{ {}, 1 };
+        Spilling v = u;
+        v.get<Bulky>().value = 2;
+
+        CHECK(u.get<Bulky>().value == 1);
+        CHECK(&u.get<Bulky>() != &v.get<Bulky>());
+
+        u = v;
+        CHECK(u.get<Bulky>().value == 2);
+        CHECK(Counted::alive == 2);
+    }
+
+    SUBCASE("moving takes the slot of the source")
+    {
+        Spilling u = Bulky{ {}, 1 };
+        const auto* slot = &u.get<Bulky>();
+
+        Spilling v = std::move(u);
+
+        CHECK(&v.get<Bulky>() == slot);
+        CHECK(u.isEmpty());
+        CHECK(Counted::alive == 1);
+
+        Spilling w = Bulky{ {}, 2 };
+        w = std::move(v);
+
+        CHECK(&w.get<Bulky>() == slot);
+        CHECK(Counted::alive == 2);
+    }
+
+    SUBCASE("switching alternatives releases the slot")
+    {
+        Spilling v = Bulky{};
+        v = 5;
+
+        CHECK(v.get<int>() == 5);
+        CHECK(Counted::alive == 0);
+
+        v.emplace<Bulky>();
+        CHECK(Counted::alive == 1);
+    }
+
+    SUBCASE("conversions between storage policies")
+    {
+        Variant<int, Bulky> inlined = Bulky{ {}, 3 };
+        Spilling spilled = inlined;
+
+        CHECK(spilled.get<Bulky>().value == 3);
+
+        inlined = 1;
+        inlined = spilled;
+        CHECK(inlined.get<Bulky>().value == 3);
+    }
+
+    CHECK(Counted::alive == 0);
 }
 
+namespace
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        int allocations = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE("variants with a memory resource")
+{
+    using V = IDragnev::pmr::Variant<int, std::pmr::string>;
+    using std::allocator_arg;
+
+    static_assert(std::uses_allocator_v<V, std::pmr::polymorphic_allocator<char>>);
+    static_assert(!std::uses_allocator_v<Variant<int, std::pmr::string>, std::pmr::polymorphic_allocator<char>>);
+
+    const auto text = "a string too long for the small buffer of std::string";
+    auto arena = CountingResource{};
+
+    SUBCASE("alternatives are constructed with the resource of the variant")
+    {
+        V v(allocator_arg, &arena, inPlaceType<std::pmr::string>, text);
+
+        REQUIRE(v.is<std::pmr::string>());
+        CHECK(v.get<std::pmr::string>() == text);
+        CHECK(v.get<std::pmr::string>().get_allocator().resource() == &arena);
+        CHECK(v.getAllocator().resource() == &arena);
+        CHECK(arena.allocations == 1);
+    }
+
+    SUBCASE("the resource is kept when the alternative changes")
+    {
+        V v(allocator_arg, &arena, 1);
+        CHECK(v.getAllocator().resource() == &arena);
+
+        v.emplace<std::pmr::string>(text);
+        CHECK(v.get<std::pmr::string>().get_allocator().resource() == &arena);
+
+        v = 2;
+        v = std::pmr::string(text);
+        CHECK(v.get<std::pmr::string>().get_allocator().resource() == &arena);
+        CHECK(arena.allocations == 2);
+    }
+
+    SUBCASE("copies and moves use the resource of the source")
+    {
+        V source(allocator_arg, &arena, std::pmr::string(text));
+        V copy = source;
+        V moved = std::move(source);
+
+        CHECK(copy.getAllocator().resource() == &arena);
+        CHECK(copy.get<std::pmr::string>().get_allocator().resource() == &arena);
+        CHECK(moved.get<std::pmr::string>().get_allocator().resource() == &arena);
+    }
+
+    SUBCASE("the target of an assignment keeps its resource")
+    {
+        auto other = CountingResource{};
+        V source(allocator_arg, &other, std::pmr::string(text));
+        V target(allocator_arg, &arena);
+
+        target = source;
+        CHECK(target.getAllocator().resource() == &arena);
+        CHECK(target.get<std::pmr::string>().get_allocator().resource() == &arena);
+
+        target = std::move(source);
+        CHECK(target.get<std::pmr::string>().get_allocator().resource() == &arena);
+    }
+
+    SUBCASE("containers pass their resource to the variants")
+    {
+        auto variants = std::pmr::vector<V>(&arena);
+        variants.emplace_back(std::pmr::string(text));
+        variants.push_back(V(3));
+
+        CHECK(variants[0].getAllocator().resource() == &arena);
+        CHECK(variants[0].get<std::pmr::string>().get_allocator().resource() == &arena);
+        CHECK(variants[1].getAllocator().resource() == &arena);
+    }
+
+    SUBCASE("the default resource is used otherwise")
+    {
+        V v;
+
+        CHECK(v.getAllocator().resource() == std::pmr::get_default_resource());
+    }
+}
+
+namespace
+{
+    struct Add;
+    struct Negate;
+
+    using Expression = Variant<double, Box<Add>, Box<Negate>>;
+
+    struct Add
+    {
+        Expression lhs;
+        Expression rhs;
+    };
+
+    struct Negate
+    {
+        Expression operand;
+        Counted counted{};
+    };
+
+    double evaluate(const Expression& e)
+    {
+        return visit(e, [](const auto& node) -> double
+        {
+            using T = std::decay_t<decltype(node)>;
+
+            if constexpr (std::is_same_v<T, double>)   { return node; }
+            else if constexpr (std::is_same_v<T, Add>) { return evaluate(node.lhs) + evaluate(node.rhs); }
+            else                                       { return -evaluate(node.operand); }
+        });
+    }
+}
+
+TEST_CASE("recursive variants through boxes")
+{
+    Counted::alive = 0;
+
+    SUBCASE("visit passes the boxed values")
+    {
+        BoxArena arena;
+        const Expression e = arena.make<Add>(Add{ 1.0, arena.make<Negate>(Negate{ 3.0 }) });
+
+        CHECK(evaluate(e) == -2.0);
+        CHECK(visit(e, [](auto& node) { return std::is_const_v<std::remove_reference_t<decltype(node)>>; }));
+    }
 
+    SUBCASE("the box itself is the alternative")
+    {
+        BoxArena arena;
+        Expression e = arena.make<Add>(Add{ 1.0, 2.0 });
+
+        REQUIRE(e.is<Box<Add>>());
+        e.get<Box<Add>>()->rhs = 5.0;
+        CHECK(evaluate(e) == 6.0);
+
+        auto copy = e;
+        copy.get<Box<Add>>()->lhs = 0.0;
+        CHECK(evaluate(e) == 5.0);
+
+        Variant<double, Box<Add>, Box<Negate>, int> wider = e;
+        CHECK(wider.get<Box<Add>>().get() == e.get<Box<Add>>().get());
+    }
+
+    SUBCASE("the arena destroys the boxed values")
+    {
+        {
+            BoxArena arena(256);
+            auto e = Expression{ 1.0 };
+
+            for (auto i = 0; i < 100; ++i)
+            {
+                e = arena.make<Negate>(Negate{ e });
+            }
+
+            CHECK(evaluate(e) == 1.0);
+            CHECK(Counted::alive == 100);
+        }
+
+        CHECK(Counted::alive == 0);
+    }
+}
+
+TEST_CASE("non-throwing and unchecked access")
+{
+    using V = Variant<int, std::string, double>;
+
+    static_assert(V::indexOf<int> == 1);
+    static_assert(V::indexOf<double> == 3);
+
+    V v = std::string("abc");
+
+    SUBCASE("getIf")
+    {
+        REQUIRE(v.getIf<std::string>() != nullptr);
+        CHECK(*v.getIf<std::string>() == "abc");
+        CHECK(v.getIf<int>() == nullptr);
+        CHECK(std::as_const(v).getIf<double>() == nullptr);
+    }
+
+    SUBCASE("index")
+    {
+        CHECK(v.index() == V::indexOf<std::string>);
+
+        switch (v.index())
+        {
+        case V::indexOf<int>: FAIL("holds a string"); break;
+        case V::indexOf<std::string>: CHECK(v.getUnchecked<std::string>() == "abc"); break;
+        default: FAIL("holds a string");
+        }
+    }
+
+    SUBCASE("getUnchecked")
+    {
+        v.getUnchecked<std::string>() += "d";
+        CHECK(std::as_const(v).getUnchecked<std::string>() == "abcd");
+
+        auto moved = std::move(v).getUnchecked<std::string>();
+        CHECK(moved == "abcd");
+    }
+
+    SUBCASE("get by index")
+    {
+        static_assert(std::is_same_v<decltype(v.get<1>()), std::string&>);
+        static_assert(std::is_same_v<decltype(std::as_const(v).get<1>()), const std::string&>);
+        static_assert(std::is_same_v<decltype(std::move(v).get<1>()), std::string&&>);
+
+        CHECK(v.get<1>() == "abc");
+
+        v = 2.5;
+        CHECK(v.get<2>() == 2.5);
+    }
+
+#if IDRAGNEV_HAS_EXCEPTIONS
+    SUBCASE("an empty variant")
+    {
+        Variant<int, Fragile> empty;
+        CHECK_THROWS(empty.emplace<Fragile>(-1));
+
+        CHECK(empty.index() == 0);
+        CHECK(empty.getIf<int>() == nullptr);
+        CHECK(empty.getIf<Fragile>() == nullptr);
+
+        CHECK_THROWS_AS(empty.get<int>(), IDragnev::EmptyVariant);
+        CHECK_THROWS_AS(visit(empty, [](const auto&) { }), IDragnev::EmptyVariant);
+    }
+#endif
+}
+
+namespace
+{
+    //each value carries a check which a torn read would break
+    struct Quote
+    {
+        std::int16_t bid;
+        std::int16_t ask;
+    };
+
+    struct Book
+    {
+        std::int64_t levels[8];
+    };
+
+    template <typename T>
+    struct Of { };
+
+    bool isConsistent(const Quote& q) { return q.ask == q.bid + 1; }
+    bool isConsistent(std::int32_t) { return true; }
+
+    bool isConsistent(const Book& b)
+    {
+        return std::all_of(std::begin(b.levels), std::end(b.levels), [&b](auto level) { return level == b.levels[0]; });
+    }
+
+    Quote makeValue(Of<Quote>, std::int32_t i) { return { std::int16_t(i), std::int16_t(i + 1) }; }
+    std::int32_t makeValue(Of<std::int32_t>, std::int32_t i) { return i; }
+
+    Book makeValue(Of<Book>, std::int32_t i)
+    {
+        auto b = Book{};
+        std::fill(std::begin(b.levels), std::end(b.levels), i);
+        return b;
+    }
+
+    template <typename T, typename Other>
+    void stress()
+    {
+        constexpr auto stores = 20'000;
+        constexpr auto readersCount = 3;
+
+        auto value = AtomicVariant<T, Other>{ makeValue(Of<T>{}, 0) };
+        auto done = std::atomic<bool>{ false };
+        auto torn = std::atomic<int>{ 0 };
+        auto readers = std::vector<std::thread>{};
+
+        for (auto r = 0; r < readersCount; ++r)
+        {
+            readers.emplace_back([&]
+            {
+                while (!done.load())
+                {
+                    const auto v = value.load();
+                    if (!visit(v, [](const auto& x) { return isConsistent(x); }))
+                    {
+                        ++torn;
+                    }
+                }
+            });
+        }
+
+        for (auto i = 1; i <= stores; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                value.store(makeValue(Of<T>{}, i));
+            }
+            else
+            {
+                value.store(makeValue(Of<Other>{}, i));
+            }
+        }
+
+        done = true;
+        for (auto& reader : readers)
+        {
+            reader.join();
+        }
+
+        CHECK(torn == 0);
+        CHECK(value.load().template is<T>());
+    }
+}
+
+TEST_CASE("atomic variants")
+{
+    static_assert(!AtomicVariant<Book, std::int32_t>::isLockFree);
+
+    SUBCASE("load returns the last stored value")
+    {
+        AtomicVariant<Quote, std::int32_t> value;
+        CHECK(value.load().is<Quote>());
+
+        value.store(std::int32_t{ 5 });
+        REQUIRE(value.load().is<std::int32_t>());
+        CHECK(value.load().get<std::int32_t>() == 5);
+
+        value.store(Variant<Quote, std::int32_t>(Quote{ 1, 2 }));
+        REQUIRE(value.load().is<Quote>());
+        CHECK(value.load().get<Quote>().ask == 2);
+    }
+
+    SUBCASE("concurrent loads of a lock-free atomic never see a partial store")
+    {
+        stress<Quote, std::int32_t>();
+    }
+
+    SUBCASE("concurrent loads of a seqlock never see a partial store")
+    {
+        stress<Book, Quote>();
+    }
+}
+
+TEST_CASE("VariantRing")
+{
+    SUBCASE("values come out in the order they went in")
+    {
+        VariantRing<int, std::string> ring(4);
+        REQUIRE(ring.capacity() == 4);
+
+        CHECK(ring.tryEmplace<int>(1));
+        CHECK(ring.tryEmplace<std::string>(3, 'a'));
+        CHECK(ring.tryEmplace<int>(2));
+
+        auto result = std::string{};
+        const auto append = [&result](const auto& x)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(x)>, int>)
+            {
+                result += std::to_string(x);
+            }
+            else
+            {
+                result += x;
+            }
+        };
+
+        while (ring.tryConsume(append)) { }
+
+        CHECK(result == "1aaa2");
+    }
+
+    SUBCASE("a full ring refuses values and an empty one has none to give")
+    {
+        VariantRing<int> ring(2);
+
+        CHECK(ring.tryEmplace<int>(1));
+        CHECK(ring.tryEmplace<int>(2));
+        CHECK(!ring.tryEmplace<int>(3));
+
+        CHECK(ring.tryConsume([](int) { }));
+        CHECK(ring.tryEmplace<int>(3));
+        CHECK(ring.tryConsume([](int) { }));
+        CHECK(ring.tryConsume([](int) { }));
+        CHECK(!ring.tryConsume([](int) { }));
+    }
+
+    SUBCASE("values are constructed and visited in place")
+    {
+        struct Immovable
+        {
+            Immovable(int x, std::string s) : x(x), s(std::move(s)) { }
+            Immovable(Immovable&&) = delete;
+
+            int x;
+            std::string s;
+        };
+
+        Counted::alive = Counted::copies = Counted::moves = 0;
+
+        {
+            VariantRing<Immovable, Counted> ring(4);
+
+            ring.emplace<Immovable>(1, "abc");
+            ring.emplace<Counted>();
+            ring.emplace<Counted>();
+
+            ring.consume([](auto& value)
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(value)>, Immovable>)
+                {
+                    CHECK(value.s == "abc");
+                }
+            });
+
+            CHECK(Counted::alive == 2);
+        }
+
+        CHECK(Counted::alive == 0);
+        CHECK(Counted::copies == 0);
+        CHECK(Counted::moves == 0);
+    }
+
+#if IDRAGNEV_HAS_EXCEPTIONS
+    SUBCASE("a value which fails to construct is skipped")
+    {
+        VariantRing<int, Fragile> ring(4);
+
+        CHECK_THROWS(ring.tryEmplace<Fragile>(-1));
+        CHECK(ring.tryEmplace<Fragile>(2));
+
+        auto value = 0;
+        CHECK(ring.tryConsume([&value](const Fragile& f) { value = f.value; }));
+        CHECK(value == 2);
+        CHECK(!ring.tryConsume([](const Fragile&) { }));
+    }
+#endif
+
+    SUBCASE("each value is consumed exactly once by concurrent consumers")
+    {
+        constexpr auto perProducer = 10'000;
+        constexpr auto threadsCount = 3;
+
+        VariantRing<std::int32_t, std::int64_t> ring(64);
+        auto consumed = std::atomic<int>{ 0 };
+        auto sum = std::atomic<std::int64_t>{ 0 };
+        auto threads = std::vector<std::thread>{};
+
+        for (auto p = 0; p < threadsCount; ++p)
+        {
+            threads.emplace_back([&ring]
+            {
+                for (auto i = 1; i <= perProducer; ++i)
+                {
+                    if (i % 2 == 0)
+                    {
+                        ring.emplace<std::int32_t>(i);
+                    }
+                    else
+                    {
+                        ring.emplace<std::int64_t>(i);
+                    }
+                }
+            });
+        }
+
+        for (auto c = 0; c < threadsCount; ++c)
+        {
+            threads.emplace_back([&]
+            {
+                while (consumed.load() < threadsCount * perProducer)
+                {
+                    if (ring.tryConsume([&sum](auto x) { sum += x; }))
+                    {
+                        ++consumed;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        CHECK(consumed == threadsCount * perProducer);
+        CHECK(sum == std::int64_t{ threadsCount } * perProducer * (perProducer + 1) / 2);
+    }
+}